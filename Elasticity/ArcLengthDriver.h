@@ -61,6 +61,9 @@ protected:
   //! \param[in] lambda Current load proportionality factor
   //! \param[in] iter Newton iteration counter
   //! \return Norm of the external load gradient, negative on failure
+  //!
+  //! \details The residual and tangential displacements are solved for
+  //! simultaneously, using the same factorization of the tangent matrix.
   double solveLinearizedSystem(double lambda, int iter = 0);
 
 private:
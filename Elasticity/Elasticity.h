@@ -16,7 +16,7 @@
 
 #include "ElasticBase.h"
 
-class LocalSystem;
+class ElasticCS;
 class ElmNorm;
 class ElmMats;
 class Tensor;
@@ -81,7 +81,12 @@ public:
   virtual Material* getMaterial() const { return material; }
 
   //! \brief Defines the local coordinate system for stress output.
-  void setLocalSystem(LocalSystem* cs) { locSys = cs; }
+  void setLocalSystem(ElasticCS* cs) { locSys = cs; }
+  //! \brief Returns \e true if a local coordinate system is defined.
+  bool haveLocalSystem() const { return locSys != nullptr; }
+  //! \brief Defines the patch association of the elements for local output.
+  //! \param[in] pchIdx 1-based patch index of each element
+  void setElmPatches(IntVec&& pchIdx) { elmPatch = std::move(pchIdx); }
 
   //! \brief Allocates element buffers for material parameters.
   //! \param[in] npar Number of material parameters in each element
@@ -252,13 +257,20 @@ public:
   bool initMaxVals(size_t nP = 0);
 
   //! \brief Returns a pointer to the max values for external update.
-  std::vector<PointValues>* getMaxVals() const { return &maxVal; }
+  std::vector<PointValues>* getMaxVals() const;
 
   //! \brief Prints out the maximum secondary solution values to the log stream.
   //! \param[in] precision Number of digits after the decimal point
   //! \param[in] comp Which component to print (0 means all)
   void printMaxVals(std::streamsize precision, size_t comp = 0) const;
 
+private:
+  //! \brief Merges the thread-wise max values into the global buffer.
+  //! \details This method is invoked whenever the max values are accessed
+  //! after a (multi-threaded) result point loop. The thread-wise buffers are
+  //! reset to zero after they have been merged.
+  void mergeMaxVals() const;
+
 protected:
   //! \brief Calculates some kinematic quantities at current point.
   //! \param[in] eV Element solution vector
@@ -271,6 +283,15 @@ protected:
 			  const Vector& N, const Matrix& dNdX, double r,
 			  Matrix& B, Tensor&, SymmTensor& eps) const;
 
+  //! \brief Returns the global-to-local transformation at current point.
+  //! \param[in] fe Finite element data at current point
+  //! \param[in] X Cartesian coordinates of current point
+  //! \details The patch containing current point is found from the element
+  //! index \a fe.iel, see setElmPatches(). The returned reference is to a
+  //! thread-local tensor, such that this method can be used in
+  //! multi-threaded result loops, and is valid until the next invocation.
+  const Tensor& getLocalTmat(const FiniteElement& fe, const Vec3& X) const;
+
   //! \brief Calculates integration point geometric stiffness contributions.
   //! \param EM Element matrix to receive the stiffness contributions
   //! \param[in] N Basis function values at current point
@@ -358,7 +379,7 @@ public:
 protected:
   // Physical properties
   Material*     material; //!< Material data and constitutive relation
-  LocalSystem*  locSys;   //!< Local coordinate system for result output
+  ElasticCS*    locSys;   //!< Local coordinate system for result output
   TractionFunc* tracFld;  //!< Pointer to implicit boundary traction field
   VecFunc*      fluxFld;  //!< Pointer to explicit boundary traction field
   VecFunc*      bodyFld;  //!< Pointer to body force field
@@ -369,7 +390,10 @@ protected:
   std::vector<FunctionBase*> dualFld; //!< Extraction functions for VCP
 
   mutable std::vector<PointValues> maxVal;  //!< Maximum result values
+  //! Thread-wise maximum result values, merged into \ref maxVal on access
+  mutable std::vector< std::vector<PointValues> > thrMaxVal;
   mutable std::vector<Vec3Pair>    tracVal; //!< Traction field point values
+  IntVec elmPatch; //!< 1-based patch index of each element
 
   unsigned short int  dS; //!< Index to element dual force vector
   unsigned short int nDF; //!< Dimension on deformation gradient (2 or 3)
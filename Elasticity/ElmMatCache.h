@@ -0,0 +1,120 @@
+// $Id$
+//==============================================================================
+//!
+//! \file ElmMatCache.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author Knut Morten Okstad / SINTEF
+//!
+//! \brief Memory-bounded cache of element matrices.
+//!
+//==============================================================================
+
+#ifndef _ELM_MAT_CACHE_H
+#define _ELM_MAT_CACHE_H
+
+#include "MatVec.h"
+
+
+/*!
+  \brief Class representing a memory-bounded cache of element matrices.
+
+  \details The matrices are stored in one contiguous arena. Matrices that are
+  exactly symmetric are packed, such that only the upper triangle is stored
+  (column-wise). Other matrices are stored in full. The cached matrices are
+  thus always retrieved exactly as they were stored. Each element may have
+  several matrices (slots), e.g., stiffness and mass, which then share the
+  same memory budget.
+
+  The cache is filled in two stages. After init(), the store() method records
+  the size of each element matrix. If the budget is unlimited, the matrices
+  are also cached right away. Then seal() is invoked, which (if the budget is
+  limited) decides which matrices to cache, by traversing the matrices in
+  the order of the element index and admitting all that fit within the
+  remaining budget. The admitted matrices are then cached by the store()
+  calls of the next assembly. This way, the set of cached matrices does not
+  depend on the order in which the elements are processed.
+
+  The store() method may be invoked from several threads simultaneously,
+  as long as each element is processed by one thread only,
+  but not concurrently with init(), seal(), has() or fetch() calls.
+*/
+
+class ElmMatCache
+{
+public:
+  //! \brief Default constructor.
+  //! \param[in] nMat Number of matrices per element
+  explicit ElmMatCache(size_t nMat = 1)
+    : nSlot(nMat), maxVal(0), nCached(0), sealed(false) {}
+
+  //! \brief Sets the memory budget of the cache.
+  //! \param[in] bytes Max size of the arena in bytes (0 means unlimited)
+  void setBudget(size_t bytes) { maxVal = bytes / sizeof(double); }
+  //! \brief Returns the memory budget of the cache in bytes.
+  size_t getBudget() const { return maxVal*sizeof(double); }
+
+  //! \brief Initializes the cache for the given number of elements.
+  //! \details Any previously cached matrices are discarded.
+  void init(size_t nEl);
+  //! \brief Decides which of the recorded element matrices to cache.
+  //! \return \e true if any matrices are (or will be) cached
+  bool seal();
+  //! \brief Discards all cached matrices and releases the memory.
+  void clear();
+
+  //! \brief Returns \e true if no matrices are cached.
+  bool empty() const { return nCached == 0; }
+  //! \brief Returns the number of cached matrices.
+  size_t size() const { return nCached; }
+  //! \brief Returns the current size of the arena in bytes.
+  size_t bytes() const { return arena.size()*sizeof(double); }
+
+  //! \brief Checks if a given element matrix is cached.
+  //! \param[in] iel 0-based element index
+  //! \param[in] imat 0-based matrix slot index
+  bool has(size_t iel, size_t imat = 0) const
+  {
+    size_t idx = iel*nSlot + imat;
+    return idx < filled.size() && filled[idx];
+  }
+
+  //! \brief Stores an element matrix in the cache, if admitted.
+  //! \param[in] iel 0-based element index
+  //! \param[in] imat 0-based matrix slot index
+  //! \param[in] A The element matrix to store
+  //! \return \e true if the matrix was cached, otherwise \e false
+  bool store(size_t iel, size_t imat, const Matrix& A);
+  //! \brief Retrieves a cached element matrix.
+  //! \param[in] iel 0-based element index
+  //! \param[in] imat 0-based matrix slot index
+  //! \param[out] A The element matrix
+  //! \return \e false if the matrix is not cached, otherwise \e true
+  bool fetch(size_t iel, size_t imat, Matrix& A) const;
+
+private:
+  //! \brief Returns the number of values needed to store matrix \a idx.
+  size_t nValues(size_t idx) const
+  {
+    return packed[idx] ? dim[idx]*(dim[idx]+1)/2 : dim[idx]*dim[idx];
+  }
+
+  //! \brief Copies a matrix into the arena at the given offset.
+  void copyIn(size_t pos, const Matrix& A, bool pack);
+
+  static constexpr size_t npos = size_t(-1); //!< Offset of uncached matrices
+
+  size_t nSlot;   //!< Number of matrices per element
+  size_t maxVal;  //!< Max number of values in the arena (0 means unlimited)
+  size_t nCached; //!< Number of cached matrices
+  bool   sealed;  //!< If \e true, the admitted matrices have been decided
+
+  std::vector<size_t> offset; //!< Arena offset of each element matrix
+  std::vector<size_t> dim;    //!< Dimension of each element matrix
+  std::vector<char>   packed; //!< Symmetric storage flag of each matrix
+  std::vector<char>   filled; //!< Cached flag of each element matrix
+  RealArray           arena;  //!< Values of all cached matrices
+};
+
+#endif
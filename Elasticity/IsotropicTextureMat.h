@@ -15,7 +15,6 @@
 #define _ISOTROPIC_TEXTURE_MAT_H
 
 #include "LinIsotropic.h"
-#include <array>
 #include <map>
 
 
@@ -29,10 +28,17 @@ public:
   //! \brief The constructor forwards to the parent class constructor.
   //! \param[in] ps If \e true, assume plane stress in 2D
   //! \param[in] ax If \e true, assume 3D axi-symmetric material
-  IsotropicTextureMat(bool ps, bool ax) : LinIsotropic(ps,ax) {}
+  IsotropicTextureMat(bool ps, bool ax) : LinIsotropic(ps,ax)
+  { nrow = ncol = 0; }
   //! \brief Empty destructor.
   virtual ~IsotropicTextureMat() = default;
 
+  //! \brief Mark as non-copyable, since \ref matTable points into
+  //! \ref materials of this object.
+  IsotropicTextureMat(const IsotropicTextureMat&) = delete;
+  //! \brief Mark not assignable.
+  IsotropicTextureMat& operator=(const IsotropicTextureMat&) = delete;
+
   //! \brief Parses material parameters from an XML element.
   void parse(const tinyxml2::XMLElement* elem) override;
 
@@ -71,12 +77,22 @@ private:
 
 protected:
   typedef std::pair<double,double> Doubles; //!< Convenience type
-  typedef std::array<double,4>     rgba;    //!< RGB color code
 
   //! Material for different texture regions
   std::map< Doubles,LinIsotropic > materials;
-  //! Raw image texture information describing the spatial material variation
-  std::vector< std::vector<rgba> > textureData;
+
+private:
+  //! \brief Material lookup table, indexed by the values in \ref texelMat.
+  //! \details The first entry is a null pointer, representing texels with
+  //! an intensity outside all material ranges.
+  std::vector<const LinIsotropic*> matTable;
+  //! \brief Per-texel material index describing the spatial material variation.
+  //! \details The texels are stored row-wise, i.e., texel (i,j) is found at
+  //! index <tt>i+nrow*j</tt>, where \a i is along the \a u-direction.
+  std::vector<unsigned short int> texelMat;
+
+  int nrow; //!< Number of texels in the u-direction (image width)
+  int ncol; //!< Number of texels in the v-direction (image height)
 };
 
 #endif
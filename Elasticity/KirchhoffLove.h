@@ -88,6 +88,8 @@ public:
 
   //! \brief Defines the local coordinate system for stress resultant output.
   void setLocalSystem(LocalSystem* cs) { locSys = cs; }
+  //! \brief Returns \e true if a local coordinate system is defined.
+  bool haveLocalSystem() const { return locSys != nullptr; }
 
   //! \brief Defines which FE quantities are needed by the integrand.
   virtual int getIntegrandType() const;
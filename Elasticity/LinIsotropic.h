@@ -105,6 +105,19 @@ public:
                         char iop = 1, const TimeDomain* = nullptr,
                         const Tensor* = nullptr) const;
 
+  //! \brief Evaluates the constitutive relation at a batch of points.
+  //! \details If the material properties are constant, the constitutive
+  //! matrix is evaluated only once, and the stresses of all points are then
+  //! computed in one vectorizable loop. Otherwise, evaluate() is invoked
+  //! for each point.
+  virtual bool evaluateBatch(size_t nPt, unsigned short int nsd, size_t ncmp,
+                             RealArray& C, RealArray& sigma, RealArray& U,
+                             const FiniteElement* fe,
+                             const std::vector<const Vec3*>& X,
+                             const RealArray& F, const RealArray& eps,
+                             char iop = 1,
+                             const TimeDomain* prm = nullptr) const;
+
   //! \brief Evaluates the Lame-parameters at an integration point.
   //! \param[out] lambda Lame's first parameter
   //! \param[out] mu Lame's second parameter (shear modulus)
@@ -15,6 +15,7 @@
 #define _LINEAR_ELASTICITY_H
 
 #include "Elasticity.h"
+#include "ElmMatCache.h"
 
 class RealFunc;
 
@@ -50,6 +51,8 @@ public:
   //! If larger than 1, element matrix buffers are allocated to given size.
   //! If equal to 1, element matrices are recomputed.
   //! If equal to 0, reuse buffered element matrices.
+  //! Elements whose matrices did not fit within the memory budget
+  //! of the buffer are then recomputed.
   virtual void initLHSbuffers(size_t nEl);
 
   using Elasticity::initIntegration;
@@ -99,9 +102,11 @@ public:
   //! \param[in] fe Nodal and integration point data for current element
   //! \param[in] time Parameters for nonlinear and time-dependent simulations
   //!
-  //! \details This method is used to updates the element matrix buffers
-  //! \ref myKmats and \ref myMmats, in case initLHSbuffers() has been invoked
-  //! with \a nEl > 1 as argument.
+  //! \details This method is used to update the element matrix buffer
+  //! \ref myLHScache, in case initLHSbuffers() has been invoked
+  //! with \a nEl > 1 as argument. If the buffer has a limited memory budget,
+  //! the admitted element matrices are stored in the first assembly where
+  //! the buffered matrices are reused (see ElmMatCache::seal()).
   virtual bool finalizeElement(LocalIntegral& elmInt, const FiniteElement& fe,
                                const TimeDomain& time, size_t);
 
@@ -136,8 +141,7 @@ protected:
 private:
   mutable Vec3Vec* myItgPts; //!< Global Gauss point coordinates
 
-  Matrices myKmats; //!< Element stiffness matrix buffer
-  Matrices myMmats; //!< Element mass matrix buffer
+  ElmMatCache myLHScache; //!< Element stiffness and mass matrix buffer
 
   bool isModal; //!< Flag for modal dynamics simulation
 };
@@ -0,0 +1,51 @@
+// $Id$
+//==============================================================================
+//!
+//! \file LocalSystems.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author Knut Morten Okstad / SINTEF
+//!
+//! \brief Local coordinate systems for linear elasticity problems.
+//!
+//==============================================================================
+
+#ifndef _LOCAL_SYSTEMS_H
+#define _LOCAL_SYSTEMS_H
+
+#include "Tensor.h"
+
+
+/*!
+  \brief Base class for local coordinate systems of elasticity problems.
+  \details In addition to the interface of the parent class, which returns
+  a reference to an internal tensor and depends on the static patch index,
+  this class offers a reentrant method computing the transformation into a
+  tensor given by the caller, with the patch index given as argument.
+  This method may therefore be invoked concurrently from several threads.
+*/
+
+class ElasticCS : public LocalSystem
+{
+protected:
+  //! \brief The default constructor is protected to allow sub-classes only.
+  ElasticCS() {}
+
+public:
+  //! \brief Empty destructor.
+  virtual ~ElasticCS() {}
+
+  //! \brief Computes the global-to-local transformation at the point \a X.
+  //! \param[out] T The 3&times;3 transformation tensor
+  //! \param[in] X Cartesian coordinates of the point
+  //! \param[in] pch 1-based index of the patch containing the point
+  virtual void getTmat(Tensor& T, const Vec3& X, int pch) const = 0;
+
+  //! \brief Computes the global-to-local transformation at the point \a X.
+  //! \details Uses the static patch index LocalSystem::patch,
+  //! and returns a reference to a thread-local copy of the transformation.
+  virtual const Tensor& getTmat(const Vec3& X) const;
+};
+
+#endif
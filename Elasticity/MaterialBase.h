@@ -15,6 +15,7 @@
 #define _MATERIAL_BASE_H
 
 #include "MatVec.h"
+#include <string>
 
 class Vec3;
 class Tensor;
@@ -101,6 +102,36 @@ public:
                         char iop = 1, const TimeDomain* prm = nullptr,
                         const Tensor* Fpf = nullptr) const = 0;
 
+  //! \brief Evaluates the constitutive relation at a batch of points.
+  //! \param[in] nPt Number of points in the batch
+  //! \param[in] nsd Number of spatial dimensions
+  //! \param[in] ncmp Number of stress components at each point
+  //! \param[out] C Constitutive matrices, \a ncmp*ncmp values for each point
+  //! \param[out] sigma Stress tensors, \a ncmp values for each point
+  //! \param[out] U Strain energy densities, one value for each point
+  //! \param[in] fe Finite element quantities, one object for each point
+  //! \param[in] X Cartesian coordinates, one pointer for each point
+  //! \param[in] F Deformation gradients, \a nfd*nfd values for each point
+  //! \param[in] eps Strain tensors, \a ncmp values for each point, or empty
+  //! \param[in] iop Calculation option (see evaluate())
+  //! \param[in] prm Nonlinear solution algorithm parameters
+  //!
+  //! \details The point quantities are stored consecutively, point by point,
+  //! in the given arrays. A constitutive matrix of lower dimension than
+  //! \a ncmp is stored in the upper left corner of its \a ncmp*ncmp block.
+  //! The dimension of the deformation gradients is \a nfd = 3 when the
+  //! stress tensors of a 2D problem include the &sigma;_zz component
+  //! (axisymmetric problems), and \a nfd = \a nsd otherwise.
+  //! This default implementation invokes evaluate() for each point.
+  //! Sub-classes may reimplement it to avoid the per-point overhead.
+  virtual bool evaluateBatch(size_t nPt, unsigned short int nsd, size_t ncmp,
+                             RealArray& C, RealArray& sigma, RealArray& U,
+                             const FiniteElement* fe,
+                             const std::vector<const Vec3*>& X,
+                             const RealArray& F, const RealArray& eps,
+                             char iop = 1,
+                             const TimeDomain* prm = nullptr) const;
+
   //! \brief Evaluates the Lame-parameters at an integration point.
   virtual bool evaluate(double&, double&, const FiniteElement&,
                         const Vec3&) const { return false; }
@@ -111,6 +142,14 @@ public:
   //! \brief Returns whether the material model has diverged or not.
   virtual bool diverged(size_t = 0) const { return false; }
 
+  //! \brief Discards the non-converged state of the history variables.
+  //! \details This method is invoked on iteration cut-back.
+  virtual void rollback() {}
+  //! \brief Serializes the history variables for restarting purposes.
+  virtual bool serialize(std::string&) const { return false; }
+  //! \brief Restores the history variables from serialized data.
+  virtual bool deSerialize(const std::string&) { return false; }
+
   //! \brief Returns number of internal result variables of the material model.
   virtual int getNoIntVariables() const { return 0; }
   //! \brief Returns number of element-wise parameters of the material model.
@@ -128,13 +167,19 @@ public:
   //! \brief Returns the value of an internal variable.
   //! \param[in] idx 1-based index of the internal variable
   //! \param[in] iGP 1-based global integration point counter
-  double getInternalVariable(int idx, size_t iGP) const
+  //! \param[in] sigma Stress tensor at current point, if available
+  double getInternalVariable(int idx, size_t iGP,
+                             const SymmTensor* sigma = nullptr) const
   {
-    return this->getInternalVar(idx,nullptr,iGP);
+    return this->getInternalVar(idx,nullptr,iGP,sigma);
   }
 
   //! \brief Returns an internal variable associated with the material model.
-  virtual double getInternalVar(int, char*, size_t = 0) const { return 0.0; }
+  virtual double getInternalVar(int, char*, size_t = 0,
+                                const SymmTensor* = nullptr) const
+  {
+    return 0.0;
+  }
 
   //! \brief Returns the label of an element-wise material parameter.
   virtual const char* getElParamLabel(int) const { return "(unnamed)"; }
@@ -98,6 +98,19 @@ public:
                    utl::LogStream* oss, bool printMax, double dtDump,
                    double zero_tol = 1.0e-8, std::streamsize outPrec = 0);
 
+  //! \brief Solves the equation system of current load step.
+  //! \param param Time stepping parameters
+  //! \param[in] mode Solution mode to use for this step
+  //! \param[in] zero_tol Truncate norm values smaller than this to zero
+  //! \param[in] outPrec Number of digits after the decimal point in norm print
+  //!
+  //! \details If the factor-once mode is enabled, only the first step is
+  //! solved by the parent class method. The subsequent steps only assemble
+  //! the right-hand-side vector, and reuse the already factorized stiffness
+  //! matrix in the linear solve.
+  virtual SIM::ConvStatus solveStep(TimeStep& param, SIM::SolutionMode mode,
+                                    double zero_tol, std::streamsize outPrec);
+
   //! \brief Serialize solution state for restarting purposes.
   //! \param data Container for serialized data
   virtual bool serialize(SerializeMap& data) const;
@@ -123,6 +136,13 @@ public:
   //! \brief Overrides the stop time that was read from the input file.
   void setStopTime(double t) { params.stopTime = t; }
 
+  //! \brief Toggles reuse of the factorized stiffness matrix in all steps.
+  //! \details This is valid for linear problems with constant stiffness and
+  //! homogeneous Dirichlet conditions only, e.g., multiple load cases.
+  //! If the model has inhomogeneous Dirichlet conditions, the option is
+  //! ignored and the full system is reassembled in each step instead.
+  void setFactorOnce(bool f) { factorOnce = f; haveFactors = false; }
+
 private:
   //! \brief Mark as non-copyable.
   NonlinearDriver(const NonlinearDriver&) = delete;
@@ -143,6 +163,10 @@ private:
   bool     saveE0; //!< If \e true, save added elements in initial configuration
   bool     updPt;  //!< If \e true, update new control points when projecting
 
+  bool factorOnce;  //!< If \e true, factorize the stiffness matrix only once
+  bool haveFactors; //!< If \e true, the factorized stiffness matrix is ready
+  bool asyncRst;    //!< If \e true, write restart data in the background
+
   Vector    myForces;  //!< Interface nodal forces
   RealArray myReacts;  //!< Reaction force container
   RealArray myWeights; //!< Nodal weights for the interface forces
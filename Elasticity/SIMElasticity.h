@@ -51,6 +51,9 @@ public:
 
   //! \brief Advances the time step one step forward.
   virtual bool advanceStep(TimeStep& tp);
+  //! \brief Discards the non-converged state of the material history.
+  //! \details This method is invoked on load step cut-back.
+  virtual void rollbackHistory() {}
 
   //! \brief Initializes the property containers of the model.
   virtual void clearProperties();
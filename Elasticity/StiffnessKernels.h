@@ -0,0 +1,457 @@
+// $Id$
+//==============================================================================
+//!
+//! \file StiffnessKernels.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author Knut Morten Okstad / SINTEF
+//!
+//! \brief Fixed-size kernels for the material stiffness of continuum elements.
+//!
+//==============================================================================
+
+#ifndef _STIFFNESS_KERNELS_H
+#define _STIFFNESS_KERNELS_H
+
+#include "MatVec.h"
+#include <array>
+
+
+namespace Elastic //! Dimension-independent utilities for Elasticity
+{
+  /*!
+    \brief Sparsity pattern of the nodal strain-displacement matrix.
+    \details For each displacement component \a j of a node, the associated
+    column of the nodal strain-displacement matrix [B] has exactly \a nsd
+    non-zero entries, in the rows \a row[j][m], with the values
+    \a dNdX(a,der[j][m]). The strain components are ordered as in
+    Elasticity::formBmatrix(), i.e., (xx,yy,xy) in 2D and (xx,yy,zz,xy,yz,xz)
+    in 3D.
+  */
+
+  template<unsigned short int nsd> struct Bpattern;
+
+  //! \brief Strain-displacement pattern for 2D continuum elements.
+  template<> struct Bpattern<2>
+  {
+    static constexpr size_t nstrc = 3; //!< Number of strain components
+    //! \brief Strain component indices of the non-zero B-entries
+    static constexpr unsigned char row[2][2] = {{0,2},{1,2}};
+    //! \brief Derivative direction of the non-zero B-entries
+    static constexpr unsigned char der[2][2] = {{0,1},{1,0}};
+  };
+
+  //! \brief Strain-displacement pattern for 3D continuum elements.
+  template<> struct Bpattern<3>
+  {
+    static constexpr size_t nstrc = 6; //!< Number of strain components
+    //! \brief Strain component indices of the non-zero B-entries
+    static constexpr unsigned char row[3][3] = {{0,3,5},{1,3,4},{2,4,5}};
+    //! \brief Derivative direction of the non-zero B-entries
+    static constexpr unsigned char der[3][3] = {{0,1,2},{1,0,2},{2,1,0}};
+  };
+
+
+  /*!
+    \brief Accumulates the material stiffness \f$B^T C B |J|w\f$ directly.
+    \param EK Element stiffness matrix to receive the contributions
+    \param[in] dN Basis function gradients, column-major \a nen x \a nsd array
+    \param[in] C Constitutive matrix, column-major \a nstrc x \a nstrc array
+    \param[in] detJW Jacobian determinant times integration point weight
+    \param[in] n Number of element nodes (only referenced if \a nen is zero)
+    \param CB Scratch array of size \a nstrc*nsd*n for the product C*B
+
+    \details The strain-displacement matrix [B] is never formed. Instead,
+    the products C*B are formed node by node exploiting its sparsity pattern,
+    after which only the upper block triangle of the symmetric element matrix
+    is computed, and mirrored into the lower triangle. The number of element
+    nodes \a nen is a compile-time constant for the most common element types,
+    otherwise zero (the actual number of nodes is then given by \a n).
+  */
+
+  template<unsigned short int nsd, size_t nen>
+  void accKmat(double* EK, const double* dN, const double* C,
+               double detJW, size_t n, double* CB)
+  {
+    typedef Bpattern<nsd> Bp;
+    constexpr size_t nstrc = Bp::nstrc;
+    constexpr size_t ncb = nstrc*nsd;
+    const size_t nnod = nen > 0 ? nen : n;
+    const size_t ndof = nsd*nnod;
+
+    // Form CB_b = C*B_b*|J|w for all nodes b
+    for (size_t b = 0; b < nnod; b++)
+    {
+      double* CBb = CB + ncb*b;
+      for (unsigned short int j = 0; j < nsd; j++)
+        for (size_t k = 0; k < nstrc; k++)
+        {
+          double v = 0.0;
+          for (unsigned short int m = 0; m < nsd; m++)
+            v += C[k+nstrc*Bp::row[j][m]] * dN[b+nnod*Bp::der[j][m]];
+          CBb[k+nstrc*j] = v*detJW;
+        }
+    }
+
+    // Accumulate K_ab = B_a^T*CB_b for b >= a, and K_ba = K_ab^T for b > a
+    for (size_t a = 0; a < nnod; a++)
+    {
+      double dNa[nsd];
+      for (unsigned short int d = 0; d < nsd; d++)
+        dNa[d] = dN[a+nnod*d];
+
+      for (size_t b = a; b < nnod; b++)
+      {
+        const double* CBb = CB + ncb*b;
+        for (unsigned short int j = 0; j < nsd; j++)
+          for (unsigned short int i = 0; i < nsd; i++)
+          {
+            double kij = 0.0;
+            for (unsigned short int m = 0; m < nsd; m++)
+              kij += dNa[Bp::der[i][m]] * CBb[Bp::row[i][m]+nstrc*j];
+            EK[nsd*a+i + ndof*(nsd*b+j)] += kij;
+            if (b > a)
+              EK[nsd*b+j + ndof*(nsd*a+i)] += kij;
+          }
+      }
+    }
+  }
+
+
+  /*!
+    \brief Fixed-size variant of accKmat() with stack-allocated scratch.
+  */
+
+  template<unsigned short int nsd, size_t nen>
+  void accKmat(double* EK, const double* dN, const double* C, double detJW)
+  {
+    std::array<double,Bpattern<nsd>::nstrc*nsd*nen> CB;
+    accKmat<nsd,nen>(EK,dN,C,detJW,nen,CB.data());
+  }
+
+
+  /*!
+    \brief Voigt index pattern of the constitutive matrix in UL formulations.
+    \details The stress components are ordered as (xx,yy,zz,xy,yz,xz),
+    also in 2D where the zz-component is the hoop stress of axisymmetric
+    problems. The constitutive matrix has leading dimension 7, where the
+    7th row and column hold the volumetric terms of mixed formulations.
+  */
+
+  template<unsigned short int nsd> struct Dpattern;
+
+  //! \brief Constitutive matrix pattern for 2D continuum elements.
+  template<> struct Dpattern<2>
+  {
+    static constexpr size_t ncol = 4; //!< Number of non-mixed columns
+    //! \brief 0-based Voigt index of the tensor component (i,j)
+    static constexpr unsigned char idx[2][2] = {{0,3},{3,1}};
+  };
+
+  //! \brief Constitutive matrix pattern for 3D continuum elements.
+  template<> struct Dpattern<3>
+  {
+    static constexpr size_t ncol = 6; //!< Number of non-mixed columns
+    //! \brief 0-based Voigt index of the tensor component (i,j)
+    static constexpr unsigned char idx[3][3] = {{0,3,5},{3,1,4},{5,4,2}};
+  };
+
+
+  /*!
+    \brief Accumulates the material stiffness of updated Lagrangian elements.
+    \param EK Element stiffness matrix to receive the contributions
+    \param[in] Nr Basis function values divided by radius (axisymmetric only)
+    \param[in] dN Basis function gradients, column-major \a nen x \a nsd array
+    \param[in] dNbar Mixed basis function gradients (mixed only)
+    \param[in] D Constitutive matrix, column-major 7x7 array
+    \param[in] n Number of element nodes (only referenced if \a nen is zero)
+
+    \details This is the C++ equivalent of the Fortran subroutines
+    accKM2D/accKM3D (\a mixed = \e false) and accKMx2D/accKMx3D
+    (\a mixed = \e true), with the terms summed in the same order.
+    The constitutive matrix \a D is assumed to be scaled by |J|w already.
+  */
+
+  template<unsigned short int nsd, bool axS, bool mixed, size_t nen>
+  void accKM(double* EK, const double* Nr, const double* dN,
+             const double* dNbar, const double* D, size_t n)
+  {
+    typedef Dpattern<nsd> Dp;
+    constexpr size_t ldD = 7;
+    constexpr size_t ncol = mixed ? 7 : Dp::ncol;
+    const size_t nnod = nen > 0 ? nen : n;
+    const size_t ndof = nsd*nnod;
+
+    for (size_t a = 0; a < nnod; a++)
+    {
+      // BBC = B_a^T*D
+      double BBC[nsd][ncol];
+      for (unsigned short int i = 0; i < nsd; i++)
+        for (size_t j = 0; j < ncol; j++)
+        {
+          double v = dN[a]*D[Dp::idx[i][0]+ldD*j];
+          for (unsigned short int k = 1; k < nsd; k++)
+            v += dN[a+nnod*k]*D[Dp::idx[i][k]+ldD*j];
+          if (mixed)
+            v += dNbar[a+nnod*i]*D[6+ldD*j];
+          if (axS && i == 0)
+            v += Nr[a]*D[2+ldD*j];
+          BBC[i][j] = v;
+        }
+
+      // Gather the BBC-columns in the order they are referenced below
+      double Bk[nsd][nsd][nsd];
+      for (unsigned short int i = 0; i < nsd; i++)
+        for (unsigned short int k = 0; k < nsd; k++)
+          for (unsigned short int l = 0; l < nsd; l++)
+            Bk[k][l][i] = BBC[i][Dp::idx[k][l]];
+
+      // K_ab += BBC*B_b
+      for (size_t b = 0; b < nnod; b++)
+      {
+        double dNb[nsd], dNbarb[nsd];
+        for (unsigned short int l = 0; l < nsd; l++)
+        {
+          dNb[l] = dN[b+nnod*l];
+          if (mixed) dNbarb[l] = dNbar[b+nnod*l];
+        }
+
+        for (unsigned short int k = 0; k < nsd; k++)
+        {
+          double* ek = EK + nsd*a + ndof*(nsd*b+k);
+          double v[nsd];
+          for (unsigned short int i = 0; i < nsd; i++)
+            v[i] = ek[i];
+          for (unsigned short int l = 0; l < nsd; l++)
+            for (unsigned short int i = 0; i < nsd; i++)
+              v[i] += Bk[k][l][i] * dNb[l];
+          if (mixed)
+            for (unsigned short int i = 0; i < nsd; i++)
+              v[i] += BBC[i][6] * dNbarb[k];
+          if (axS && k == 0)
+            for (unsigned short int i = 0; i < nsd; i++)
+              v[i] += BBC[i][2] * Nr[b];
+          for (unsigned short int i = 0; i < nsd; i++)
+            ek[i] = v[i];
+        }
+      }
+    }
+  }
+
+
+  /*!
+    \brief Accumulates the material stiffness of total Lagrangian elements.
+    \param EK Element stiffness matrix to receive the contributions
+    \param[in] dN Basis function gradients, column-major \a nen x \a nsd array
+    \param[in] F Deformation gradient, column-major \a nsd x \a nsd array
+    \param[in] Cm Constitutive matrix, column-major \a nstrc x \a nstrc array
+    \param[in] detJW Jacobian determinant times integration point weight
+    \param[in] n Number of element nodes (only referenced if \a nen is zero)
+    \param Q Scratch array of size \a nsd^3*n
+
+    \details This is the C++ equivalent of the Fortran subroutines
+    stiff_TL2D/stiff_TL3D. Instead of the full sum over i,j,k,l for each
+    node pair, the products \f$Q^b_{nkl} = F_{nk} N_{b,l}\f$ are formed
+    once per node, and \f$A^a_{mkl} = Q^a_{mji} C_{ijkl}\f$ once per
+    node \a a. The node pair contribution is then a dot product of
+    length \a nsd^2. The results are equal to round-off.
+  */
+
+  template<unsigned short int nsd, size_t nen>
+  void stiffTL(double* EK, const double* dN, const double* F,
+               const double* Cm, double detJW, size_t n, double* Q)
+  {
+    constexpr size_t nstrc = nsd*(nsd+1)/2;
+    constexpr size_t nsd2 = nsd*nsd;
+    constexpr size_t nsd3 = nsd*nsd2;
+    const size_t nnod = nen > 0 ? nen : n;
+    const size_t ndof = nsd*nnod;
+
+    // Voigt index of tensor component (i,j), in the order of stiff_TL
+    constexpr unsigned char v2[2][2] = {{0,2},{2,1}};
+    constexpr unsigned char v3[3][3] = {{0,3,4},{3,1,5},{4,5,2}};
+    auto voigt = [&v2,&v3](unsigned short int i, unsigned short int j)
+    {
+      return nsd == 2 ? v2[i][j] : v3[i][j];
+    };
+
+    // Expand to the fourth-order constitutive tensor
+    double C[nsd2*nsd2];
+    for (unsigned short int i = 0; i < nsd; i++)
+      for (unsigned short int j = 0; j < nsd; j++)
+        for (unsigned short int k = 0; k < nsd; k++)
+          for (unsigned short int l = 0; l < nsd; l++)
+            C[i+nsd*j+nsd2*(k+nsd*l)] = Cm[voigt(i,j)+nstrc*voigt(k,l)];
+
+    // Q_b(n,k,l) = F(n,k)*dNdX(b,l)
+    for (size_t b = 0; b < nnod; b++)
+      for (unsigned short int l = 0; l < nsd; l++)
+        for (unsigned short int k = 0; k < nsd; k++)
+          for (unsigned short int m = 0; m < nsd; m++)
+            Q[nsd3*b + m+nsd*k+nsd2*l] = F[m+nsd*k]*dN[b+nnod*l];
+
+    for (size_t a = 0; a < nnod; a++)
+    {
+      // A_a(m,k,l) = dNdX(a,i)*F(m,j)*C(i,j,k,l) = Q_a(m,j,i)*C(i,j,k,l)
+      const double* Qa = Q + nsd3*a;
+      double A[nsd3];
+      for (size_t kl = 0; kl < nsd2; kl++)
+        for (unsigned short int m = 0; m < nsd; m++)
+        {
+          double v = 0.0;
+          for (unsigned short int i = 0; i < nsd; i++)
+            for (unsigned short int j = 0; j < nsd; j++)
+              v += Qa[m+nsd*j+nsd2*i]*C[i+nsd*j+nsd2*kl];
+          A[m+nsd*kl] = v*detJW;
+        }
+
+      for (size_t b = a; b < nnod; b++)
+      {
+        const double* Qb = Q + nsd3*b;
+        for (unsigned short int m = 0; m < nsd; m++)
+          for (unsigned short int p = 0; p < nsd; p++)
+          {
+            double km = 0.0;
+            for (size_t kl = 0; kl < nsd2; kl++)
+              km += A[m+nsd*kl]*Qb[p+nsd*kl];
+            EK[nsd*a+m + ndof*(nsd*b+p)] += km;
+            if (b > a)
+              EK[nsd*b+p + ndof*(nsd*a+m)] += km;
+          }
+      }
+    }
+  }
+
+
+  /*!
+    \brief Accumulates the total Lagrangian stiffness of isotropic materials.
+    \param EK Element stiffness matrix to receive the contributions
+    \param[in] dN Basis function gradients, column-major \a nen x \a nsd array
+    \param[in] F Deformation gradient, column-major \a nsd x \a nsd array
+    \param[in] C1 Constitutive tensor component C(1,1,1,1)
+    \param[in] C2 Constitutive tensor component C(1,1,2,2)
+    \param[in] C3 Constitutive tensor component C(1,2,1,2)
+    \param[in] detJW Jacobian determinant times integration point weight
+    \param[in] n Number of element nodes (only referenced if \a nen is zero)
+    \param W Scratch array of size \a nsd*nsd*(3*nsd-1)/2*n
+
+    \details This is the C++ equivalent of the Fortran subroutines
+    stiff_TL2D_isoel/stiff_TL3D_isoel. The nodal products
+    \f$g^a_{mi} = F_{mi} N_{a,i}\f$ and
+    \f$s^a_{m(ij)} = F_{mj} N_{a,i} + F_{mi} N_{a,j}\f$ (for \a i < \a j)
+    are formed once per node, such that the three tensor contractions of
+    each node pair reduce to short dot products of these.
+  */
+
+  template<unsigned short int nsd, size_t nen>
+  void stiffTLiso(double* EK, const double* dN, const double* F,
+                  double C1, double C2, double C3, double detJW,
+                  size_t n, double* W)
+  {
+    constexpr size_t nsd2 = nsd*nsd;
+    constexpr size_t npair = nsd*(nsd-1)/2;
+    constexpr size_t nw = nsd2 + nsd*npair;
+    const size_t nnod = nen > 0 ? nen : n;
+    const size_t ndof = nsd*nnod;
+
+    for (size_t a = 0; a < nnod; a++)
+    {
+      double* g = W + nw*a;
+      double* s = g + nsd2;
+      for (unsigned short int m = 0; m < nsd; m++)
+      {
+        size_t p = 0;
+        for (unsigned short int i = 0; i < nsd; i++)
+        {
+          g[m+nsd*i] = F[m+nsd*i]*dN[a+nnod*i];
+          for (unsigned short int j = i+1; j < nsd; j++, p++)
+            s[m+nsd*p] = F[m+nsd*j]*dN[a+nnod*i] + F[m+nsd*i]*dN[a+nnod*j];
+        }
+      }
+    }
+
+    for (size_t a = 0; a < nnod; a++)
+    {
+      const double* ga = W + nw*a;
+      const double* sa = ga + nsd2;
+      for (size_t b = a; b < nnod; b++)
+      {
+        const double* gb = W + nw*b;
+        const double* sb = gb + nsd2;
+        for (unsigned short int m = 0; m < nsd; m++)
+          for (unsigned short int q = 0; q < nsd; q++)
+          {
+            double ek1 = 0.0, ek2 = 0.0, ek3 = 0.0;
+            for (unsigned short int i = 0; i < nsd; i++)
+            {
+              ek1 += ga[m+nsd*i]*gb[q+nsd*i];
+              for (unsigned short int j = i+1; j < nsd; j++)
+                ek2 += ga[m+nsd*i]*gb[q+nsd*j] + ga[m+nsd*j]*gb[q+nsd*i];
+            }
+            for (size_t p = 0; p < npair; p++)
+              ek3 += sa[m+nsd*p]*sb[q+nsd*p];
+
+            const double km = (ek1*C1 + ek2*C2 + ek3*C3)*detJW;
+            EK[nsd*a+m + ndof*(nsd*b+q)] += km;
+            if (b > a)
+              EK[nsd*b+q + ndof*(nsd*a+m)] += km;
+          }
+      }
+    }
+  }
+
+
+  //! \brief Accumulates the updated Lagrangian material stiffness matrix.
+  //! \param[in] nsd Number of space dimensions (2 or 3)
+  //! \param[in] axS If \e true, an axisymmetric 2D problem is assumed
+  //! \param[in] nen Number of element nodes
+  //! \param[in] Nr Basis function values divided by radius (axisymmetric only)
+  //! \param[in] dNdx Basis function gradients
+  //! \param[in] dNdxBar Mixed basis function gradients (nullptr if not mixed)
+  //! \param[in] D Constitutive matrix (7x7), scaled by |J|w
+  //! \param EK Element stiffness matrix to receive the contributions
+  void accKM(unsigned short int nsd, bool axS, size_t nen,
+             const double* Nr, const double* dNdx, const double* dNdxBar,
+             const double* D, double* EK);
+
+  //! \brief Accumulates the total Lagrangian material stiffness matrix.
+  //! \param[in] nsd Number of space dimensions (2 or 3)
+  //! \param[in] nen Number of element nodes
+  //! \param[in] detJW Jacobian determinant times integration point weight
+  //! \param[in] dNdX Basis function gradients
+  //! \param[in] F Deformation gradient
+  //! \param[in] C Constitutive matrix
+  //! \param EK Element stiffness matrix to receive the contributions
+  void stiffTL(unsigned short int nsd, size_t nen, double detJW,
+               const double* dNdX, const double* F, const double* C,
+               double* EK);
+
+  //! \brief Accumulates the total Lagrangian stiffness of isotropic materials.
+  //! \param[in] nsd Number of space dimensions (2 or 3)
+  //! \param[in] nen Number of element nodes
+  //! \param[in] detJW Jacobian determinant times integration point weight
+  //! \param[in] dNdX Basis function gradients
+  //! \param[in] F Deformation gradient
+  //! \param[in] C1 Constitutive tensor component C(1,1,1,1)
+  //! \param[in] C2 Constitutive tensor component C(1,1,2,2)
+  //! \param[in] C3 Constitutive tensor component C(1,2,1,2)
+  //! \param EK Element stiffness matrix to receive the contributions
+  void stiffTLiso(unsigned short int nsd, size_t nen, double detJW,
+                  const double* dNdX, const double* F,
+                  double C1, double C2, double C3, double* EK);
+
+
+  //! \brief Accumulates the material stiffness matrix of a continuum element.
+  //! \param EK Element stiffness matrix to receive the contributions
+  //! \param[in] dNdX Basis function gradients at current point
+  //! \param[in] C Constitutive matrix at current point
+  //! \param[in] detJW Jacobian determinant times integration point weight
+  //! \param[in] nsd Number of space dimensions
+  //! \return \e false if the kernel does not apply to the given dimensions,
+  //! in which case the caller has to use the explicit \f$B^T C B\f$ product
+  bool formKmat(Matrix& EK, const Matrix& dNdX, const Matrix& C,
+                double detJW, unsigned short int nsd);
+}
+
+#endif
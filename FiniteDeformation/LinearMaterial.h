@@ -79,7 +79,8 @@ public:
   virtual int getNoElParameters() const;
 
   //! \brief Returns an internal variable associated with the material model.
-  virtual double getInternalVar(int idx, char* label, size_t iGP) const;
+  virtual double getInternalVar(int idx, char* label, size_t iGP,
+                                const SymmTensor* sigma) const;
 
   //! \brief Returns the label of an element-wise material parameter.
   //! \param[in] idx 1-based index of the material parameter
@@ -0,0 +1,102 @@
+// $Id$
+//==============================================================================
+//!
+//! \file MaterialBatch.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author Knut Morten Okstad / SINTEF
+//!
+//! \brief Integration point buffer for batched material evaluation.
+//!
+//==============================================================================
+
+#ifndef _MATERIAL_BATCH_H
+#define _MATERIAL_BATCH_H
+
+#include "FiniteElement.h"
+#include "Vec3.h"
+
+class Material;
+class Tensor;
+class SymmTensor;
+struct TimeDomain;
+
+
+/*!
+  \brief Class collecting the material input of the integration points of
+  an element, for evaluation of the constitutive relation in one call.
+  \details The nonlinear integrands register the integration points in their
+  \a evalInt method, and evaluate the material for all points of the element
+  in their \a finalizeElement method, through Material::evaluateBatch().
+  The buffers are kept from one element to the next to avoid reallocations,
+  so an object of this class is typically declared \a thread_local.
+  Only the point quantities needed by the material are stored, i.e.,
+  the deformation gradient, the strains, the point coordinates and the
+  integration point volume. The finite element data of each point is
+  reduced to the point identification and parameters, without the basis
+  function values and gradients.
+*/
+
+class MaterialBatch
+{
+public:
+  //! \brief Default constructor.
+  MaterialBatch() : nsd(0), nfd(0), ncmp(0), nPt(0), sameOp(true) {}
+
+  //! \brief Empties the batch, keeping the allocated buffers.
+  //! \param[in] n Number of spatial dimensions
+  //! \param[in] withZZ If \e true, the stresses include the &sigma;_zz term
+  void clear(unsigned short int n, bool withZZ);
+
+  //! \brief Adds a point to the batch.
+  //! \param[in] fe Finite element data of the point
+  //! \param[in] X Cartesian coordinates (and time, if a Vec4) of the point
+  //! \param[in] F Deformation gradient at the point
+  //! \param[in] eps Strain tensor at the point
+  //! \param[in] detJW Integration point volume
+  //! \param[in] iop Calculation option (see Material::evaluate())
+  void add(const FiniteElement& fe, const Vec3& X, const Tensor& F,
+           const SymmTensor& eps, double detJW, char iop);
+
+  //! \brief Evaluates the constitutive relation at all points of the batch.
+  //! \param[in] mat The material model to evaluate
+  //! \param[in] prm Nonlinear solution algorithm parameters
+  //!
+  //! \details If the points have different calculation options,
+  //! the material is evaluated point by point instead.
+  bool evaluate(const Material* mat, const TimeDomain* prm);
+
+  //! \brief Returns the number of points in the batch.
+  size_t size() const { return nPt; }
+
+  //! \brief Returns the Cartesian coordinates of point \a p.
+  const Vec4& getX(size_t p) const { return myX[p]; }
+  //! \brief Returns the integration point volume of point \a p.
+  double getDetJW(size_t p) const { return myDetJW[p]; }
+  //! \brief Returns the constitutive matrix of point \a p.
+  void getC(size_t p, Matrix& C) const;
+  //! \brief Returns the stress tensor of point \a p.
+  void getStress(size_t p, SymmTensor& sigma) const;
+
+private:
+  unsigned short int nsd; //!< Number of spatial dimensions
+  unsigned short int nfd; //!< Dimension of the deformation gradients
+  size_t ncmp; //!< Number of stress components at each point
+  size_t nPt;  //!< Number of points in the batch
+  bool sameOp; //!< If \e false, the points have different calculation options
+
+  std::vector<FiniteElement> myFE; //!< Point identification and parameters
+  std::vector<Vec4>          myX;  //!< Cartesian coordinates of the points
+  std::vector<const Vec3*>   myXp; //!< Pointers to the point coordinates
+  std::vector<char>          myOp; //!< Calculation options of the points
+
+  RealArray myDetJW; //!< Integration point volumes
+  RealArray myF;   //!< Deformation gradients, \a nfd*nfd values per point
+  RealArray myEps; //!< Strain tensors, \a ncmp values per point
+  RealArray myC;   //!< Constitutive matrices, \a ncmp*ncmp values per point
+  RealArray mySig; //!< Stress tensors, \a ncmp values per point
+  RealArray myU;   //!< Strain energy densities, one value per point
+};
+
+#endif
@@ -0,0 +1,126 @@
+// $Id$
+//==============================================================================
+//!
+//! \file MaterialHistory.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author Knut Morten Okstad / SINTEF
+//!
+//! \brief Integration point history database for history-dependent materials.
+//!
+//==============================================================================
+
+#ifndef _MATERIAL_HISTORY_H
+#define _MATERIAL_HISTORY_H
+
+#include "MatVec.h"
+#include <string>
+
+
+/*!
+  \brief Class representing the point-wise history data of a material model.
+
+  \details The data is organized as a structure of arrays, where each field
+  (e.g., the internal variables, or the previous deformation gradient) is
+  stored in one contiguous array over all points, with the components of each
+  point stored consecutively. A history field has two such arrays, one for the
+  last converged state and one for the trial state of the current iteration.
+  In addition, a status byte is kept for each point, telling whether its
+  trial state has been updated since the last commit() or reset() call.
+
+  A commit is done by swapping the converged and trial arrays, such that the
+  cost is independent of the number of components, whereas a rollback only
+  needs to reset the status bytes, since the trial state of a point always
+  is initialized from the converged state before it is evaluated.
+*/
+
+class MaterialHistory
+{
+  //! \brief Struct holding the data of one point field.
+  struct Field
+  {
+    size_t    ncmp; //!< Number of components per point
+    bool      hist; //!< If \e true, converged values are stored separately
+    RealArray init; //!< Initial values of the components
+    RealArray val;  //!< Current (trial) values
+    RealArray old;  //!< Converged values (history fields only)
+  };
+
+public:
+  //! \brief Default constructor.
+  MaterialHistory() : nPts(0) {}
+
+  //! \brief Registers a new point field.
+  //! \param[in] init Initial values of the field components
+  //! \param[in] history If \e true, separate converged and trial values are
+  //! stored, otherwise the field has only one state
+  //! \return 0-based index of the new field
+  size_t addField(const RealArray& init, bool history = false);
+
+  //! \brief Resizes the database to the given number of points.
+  //! \details The values of existing points are preserved,
+  //! whereas new points are assigned the initial field values.
+  void resize(size_t n);
+  //! \brief Returns the number of points in the database.
+  size_t size() const { return nPts; }
+
+  //! \brief Returns the (trial) values of a field at a given point.
+  //! \param[in] f 0-based field index
+  //! \param[in] i 0-based point index
+  double* get(size_t f, size_t i)
+  {
+    return myFields[f].val.data() + myFields[f].ncmp*i;
+  }
+  //! \brief Returns the (trial) values of a field at a given point.
+  //! \param[in] f 0-based field index
+  //! \param[in] i 0-based point index
+  const double* get(size_t f, size_t i) const
+  {
+    return myFields[f].val.data() + myFields[f].ncmp*i;
+  }
+  //! \brief Returns the converged values of a field at a given point.
+  //! \param[in] f 0-based field index
+  //! \param[in] i 0-based point index
+  const double* getConverged(size_t f, size_t i) const
+  {
+    const Field& fld = myFields[f];
+    return (fld.hist ? fld.old : fld.val).data() + fld.ncmp*i;
+  }
+
+  //! \brief Initializes the trial values of a point from the converged state.
+  //! \param[in] i 0-based point index
+  void restore(size_t i);
+
+  //! \brief Returns a reference to the status byte of a given point.
+  char& status(size_t i) { return myStatus[i]; }
+  //! \brief Returns the status byte of a given point.
+  char status(size_t i) const { return myStatus[i]; }
+  //! \brief Returns \e true if at least one point has the given status.
+  bool hasStatus(char s) const;
+
+  //! \brief Accepts the trial state of all updated points as converged.
+  //! \return Number of updated points
+  size_t commit();
+  //! \brief Resets the point status without updating the converged state.
+  void reset();
+  //! \brief Discards the trial state of all updated points.
+  void rollback() { this->reset(); }
+
+  //! \brief Serializes the state into a binary string.
+  //! \details The trial values of the updated points are serialized as if
+  //! they were committed, such that the serialized state is the same whether
+  //! the commit() of a converged increment is done before or after.
+  bool serialize(std::string& data) const;
+  //! \brief Restores the converged state from a binary string.
+  //! \details The fields must have been registered in the same order,
+  //! and with the same number of components, as when serialized.
+  bool deSerialize(const std::string& data);
+
+private:
+  size_t             nPts;     //!< Number of points in the database
+  std::vector<Field> myFields; //!< The point fields
+  std::vector<char>  myStatus; //!< Point status bytes
+};
+
+#endif
@@ -0,0 +1,205 @@
+// $Id$
+//==============================================================================
+//!
+//! \file MixedCondensation.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author Knut Morten Okstad / SINTEF
+//!
+//! \brief Static condensation kernels for mixed elements with internal modes.
+//!
+//==============================================================================
+
+#ifndef _MIXED_CONDENSATION_H
+#define _MIXED_CONDENSATION_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+
+namespace MixedMat
+{
+  /*!
+    \brief Inverts a square matrix in place.
+    \param H Column-major \a nPM x \a nPM matrix to invert
+    \param[in] n Matrix dimension (only referenced if \a nPM is zero)
+    \return \e false if the matrix is singular
+
+    \details Gauss-Jordan elimination with partial (row) pivoting.
+    The row interchanges are undone by interchanging the corresponding
+    columns of the inverse in reverse order after the elimination.
+    The matrix dimension \a nPM is a compile-time constant for the common
+    cases, otherwise zero (the actual dimension is then given by \a n).
+  */
+
+  template<size_t nPM>
+  bool invertH(double* H, size_t n)
+  {
+    const size_t m = nPM > 0 ? nPM : n;
+    std::array<size_t,nPM> fixedPiv;
+    std::vector<size_t> dynPiv(nPM > 0 ? 0 : m);
+    size_t* ipiv = nPM > 0 ? fixedPiv.data() : dynPiv.data();
+
+    for (size_t k = 0; k < m; k++)
+    {
+      // Find the pivot row, the largest entry in column k below the diagonal
+      size_t p = k;
+      for (size_t i = k+1; i < m; i++)
+        if (fabs(H[i+m*k]) > fabs(H[p+m*k]))
+          p = i;
+
+      if (H[p+m*k] == 0.0) return false;
+
+      ipiv[k] = p;
+      if (p != k)
+        for (size_t j = 0; j < m; j++)
+          std::swap(H[k+m*j],H[p+m*j]);
+
+      double* Hk = H + k; // Row k, stride m
+      const double piv = Hk[m*k];
+      Hk[m*k] = 1.0;
+      for (size_t j = 0; j < m; j++)
+        Hk[m*j] /= piv;
+
+      for (size_t i = 0; i < m; i++)
+        if (i != k)
+        {
+          const double f = H[i+m*k];
+          H[i+m*k] = 0.0;
+          for (size_t j = 0; j < m; j++)
+            H[i+m*j] -= f*Hk[m*j];
+        }
+    }
+
+    // Undo the row interchanges by interchanging columns in reverse order
+    for (size_t k = m; k > 0; k--)
+      if (ipiv[k-1] != k-1)
+        std::swap_ranges(H+m*(k-1),H+m*k,H+m*ipiv[k-1]);
+
+    return true;
+  }
+
+
+  /*!
+    \brief Condenses the internal pressure/volumetric-change modes.
+    \param Theta Mixed volume ratios (current and previous) at each point
+    \param dNdxBar Mixed basis function gradients at each point,
+    column-major \a nEN x \a nsd arrays stored consecutively
+    \param W Scratch array of size \a m*(nEN*nsd+3)
+    \param[in] Hi Inverse of the H-matrix of the pressure modes
+    \param[in] Phi Pressure mode values at each point, stored consecutively
+    \param[in] dV Volume measures (current and previous) at each point
+    \param[in] dNdx Basis function gradients at each point
+    \param[in] Nr Basis function values divided by radius at each point
+    (nullptr if not axisymmetric)
+    \param[in] nGP Number of integration points in the element
+    \param[in] nEN Number of element nodes
+    \param[in] n Number of pressure modes (only referenced if \a nPM is zero)
+
+    \details Instead of forming the condensed gradient matrices
+    \f$\bar{G}_i = \sum_j H^{-1}_{ij} G_j\f$, the mode coefficients
+    \f$c = H^{-1}\Phi\f$ are computed for each point, such that
+    \f$\Theta = J\cdot c\f$ and \f$\bar{N}_{,x} = \sum_i c_i G_i/\Theta\f$.
+    This is also used for a single constant pressure mode, where the
+    operations are ordered differently than in the former closed-form
+    expressions, such that the results may differ in the last digits.
+  */
+
+  template<unsigned short int nsd, size_t nPM>
+  void condense(double* Theta, double* dNdxBar, double* W,
+                const double* Hi, const double* Phi, const double* dV,
+                const double* const* dNdx, const double* const* Nr,
+                size_t nGP, size_t nEN, size_t n)
+  {
+    const size_t m = nPM > 0 ? nPM : n;
+    const size_t ndn = nEN*nsd;
+    double* J1 = W;
+    double* J2 = W + m;
+    double* c  = W + 2*m;
+    double* G  = W + 3*m;
+    std::fill(W,W+m*(ndn+3),0.0);
+
+    // Integrate the Ji- and G-matrices
+    for (size_t g = 0; g < nGP; g++)
+    {
+      const double* phi = Phi + m*g;
+      const double* dN  = dNdx[g];
+      for (size_t i = 0; i < m; i++)
+      {
+        const double h1 = phi[i]*dV[2*g];
+        J1[i] += h1;
+        J2[i] += phi[i]*dV[2*g+1];
+        double* Gi = G + ndn*i;
+        for (size_t k = 0; k < ndn; k++)
+          Gi[k] += h1*dN[k];
+        if (Nr)
+          for (size_t a = 0; a < nEN; a++)
+            Gi[a] += h1*Nr[g][a];
+      }
+    }
+
+    for (size_t g = 0; g < nGP; g++)
+    {
+      // Calculate the mode coefficients c = Hi*Phi
+      const double* phi = Phi + m*g;
+      for (size_t i = 0; i < m; i++)
+      {
+        c[i] = 0.0;
+        for (size_t j = 0; j < m; j++)
+          c[i] += Hi[i+m*j]*phi[j];
+      }
+
+      // Calculate Theta = Hi*Ji*Phi
+      double th1 = 0.0, th2 = 0.0;
+      for (size_t i = 0; i < m; i++)
+      {
+        th1 += J1[i]*c[i];
+        th2 += J2[i]*c[i];
+      }
+      Theta[2*g]   = th1;
+      Theta[2*g+1] = th2;
+
+      // Calculate dNdxBar = Hi*G*Phi * 1/Theta
+      double* dB = dNdxBar + ndn*g;
+      std::fill(dB,dB+ndn,0.0);
+      for (size_t i = 0; i < m; i++)
+      {
+        const double s = c[i]/th1;
+        const double* Gi = G + ndn*i;
+        for (size_t k = 0; k < ndn; k++)
+          dB[k] += s*Gi[k];
+      }
+    }
+  }
+
+
+  //! \brief Inverts the H-matrix of the internal pressure modes in place.
+  //! \param[in] nPM Number of pressure modes
+  //! \param H Column-major H-matrix to invert
+  bool invertH(size_t nPM, double* H);
+
+  //! \brief Condenses the internal pressure/volumetric-change modes.
+  //! \param[in] nsd Number of space dimensions (2 or 3)
+  //! \param[in] nPM Number of pressure modes
+  //! \param[in] nGP Number of integration points in the element
+  //! \param[in] nEN Number of element nodes
+  //! \param[in] Hi Inverse of the H-matrix of the pressure modes
+  //! \param[in] Phi Pressure mode values at each point
+  //! \param[in] dV Volume measures (current and previous) at each point
+  //! \param[in] dNdx Basis function gradients at each point
+  //! \param[in] Nr Basis function values divided by radius at each point
+  //! \param[out] Theta Mixed volume ratios (current and previous) at each point
+  //! \return Pointer to the mixed basis function gradients at each point,
+  //! stored in a per-thread buffer valid until the next invocation
+  const double* condense(unsigned short int nsd, size_t nPM,
+                         size_t nGP, size_t nEN,
+                         const double* Hi, const double* Phi, const double* dV,
+                         const double* const* dNdx, const double* const* Nr,
+                         double* Theta);
+}
+
+#endif
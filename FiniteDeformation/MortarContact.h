@@ -18,6 +18,7 @@
 #include "IntegrandBase.h"
 #include "SparseMatrix.h"
 #include "ElmMats.h"
+#include <map>
 
 class LocalIntegral;
 class RigidBody;
@@ -32,6 +33,9 @@ typedef unsigned short int usint; //!< Convenience type declaration
 
 class MortarMats : public GlobalIntegral
 {
+  //! \brief Column index and position of the first row of a node in a column.
+  typedef std::pair<size_t,size_t> NodeCol;
+
 public:
   //! \brief The constructor initializes the Mortar matrices to proper size.
   //! \param[in] _sam Reference to the FE assembly management object to use
@@ -66,13 +70,31 @@ public:
   //! \brief Returns the SAM object associated with these Mortar matrices.
   const SAM& getSAM() const { return sam; }
 
+  //! \brief Evaluates a row of nodal blocks of the product phiA*diag(c)*phiA^T.
+  //! \param[in] inod 1-based index of the node of the block row
+  //! \param[in] c Column scaling factors, zero for inactive columns
+  //! \param[out] blocks Nodal blocks of node \a inod, and the nodes after it
+  //! \param[in] allPairs If \e true, blocks coupled through inactive columns
+  //! only are included too (with zero values), otherwise they are omitted
+  void nodalProduct(size_t inod, const RealArray& c,
+                    std::map<size_t,Matrix>& blocks, bool allPairs) const;
+
 private:
+  //! \brief Establishes the sparsity pattern of the auxiliary Mortar matrix.
+  //! \param[in] nSlv Number of slave nodes
+  //! \param[in] nNod Total number of nodes (slave and master)
+  void initPattern(int nSlv, int nNod);
+
   const SAM&   sam;  //!< Data for FE assembly management
   SparseMatrix phiA; //!< Matrix of auxiliary constants
   Vector       gNA;  //!< Weighted nodal gaps
   Vector       AA;   //!< Weighted nodal areas
   usint        nsd;  //!< Number of space dimensions
-  int          nthr; //!< Number of threads during assembly
+
+  std::vector<size_t> colPtr; //!< Start of each column of compressed phiA
+  std::vector<size_t> rowIdx; //!< 1-based row indices of compressed phiA
+  RealArray           colVal; //!< Non-zero values of compressed phiA
+  std::vector< std::vector<NodeCol> > nodCols; //!< Columns of each node
 };
 
 
@@ -108,7 +130,8 @@ public:
   using IntegrandBase::getLocalIntegral;
   //! \brief Returns a local integral container for the given element.
   //! \param[in] nen Number of nodes on element
-  virtual LocalIntegral* getLocalIntegral(size_t nen, size_t, bool) const;
+  //! \param[in] iEl Global element number
+  virtual LocalIntegral* getLocalIntegral(size_t nen, size_t iEl, bool) const;
   //! \brief Returns the system quantity to be integrated by \a *this.
   virtual GlobalIntegral& getGlobalInt(GlobalIntegral*) const { return *myInt; }
 
@@ -150,12 +173,14 @@ protected:
   //! \param Ktan System tangent stiffness matrix
   //! \param Res System residual vector
   //! \param[in] mortar Mortar matrices giving the tangent contributions
+  //! \param[in] allPairs If \e true, all node pairs that may couple are
+  //! assembled, to establish the sparsity pattern of the tangent matrix
   //!
   //! \details This method assembles direct nodal contributions to the
   //! system matrices emanating from the Mortar method formulation,
   //! which cannot be assembled through the normal element assembly loop.
   bool assResAndTangent(SystemMatrix& Ktan, SystemVector& Res,
-                        const MortarMats& mortar) const;
+                        const MortarMats& mortar, bool allPairs = false) const;
 
   //! \brief Prints some additional information in case of poor convergence
   //! \param cStat Nodal contact statuses
@@ -163,6 +188,19 @@ protected:
   void printAdditionalInfo(std::map<size_t,char>& cStat,
                            const MortarMats& mortar) const;
 
+  //! \brief Class representing the element matrices of a contact element.
+  class ContactElmMats : public ElmMats
+  {
+  public:
+    //! \brief The constructor initializes the contact candidate flag.
+    explicit ContactElmMats(bool c) : candidate(c) { withLHS = true; }
+    //! \brief Empty destructor.
+    virtual ~ContactElmMats() {}
+
+    //! If \e false, the element is clearly out of contact and not integrated
+    bool candidate;
+  };
+
 private:
   GlobalIntegral* myInt; //!< Pointer to resulting global integrated quantity
 
@@ -203,7 +241,8 @@ public:
   using MortarContact::getLocalIntegral;
   //! \brief Returns a local integral container for the given element.
   //! \param[in] nen Number of nodes on element
-  virtual LocalIntegral* getLocalIntegral(size_t nen, size_t, bool) const;
+  //! \param[in] iEl Global element number
+  virtual LocalIntegral* getLocalIntegral(size_t nen, size_t iEl, bool) const;
   //! \brief Returns the system quantity to be integrated by \a *this.
   virtual GlobalIntegral& getGlobalInt(GlobalIntegral* eq) const { return *eq; }
 
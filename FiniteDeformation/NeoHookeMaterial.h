@@ -64,45 +64,74 @@ public:
                         char iop = 1, const TimeDomain* = nullptr,
                         const Tensor* Fpf = nullptr) const;
 
+  //! \brief Evaluates the constitutive relation at a batch of points.
+  //! \details For the standard model with constant material properties in 3D,
+  //! the Cauchy stresses and the tangent constitutive matrix of all points
+  //! are computed in branch-free loops over the contiguous deformation
+  //! gradients, such that they can be vectorized by the compiler.
+  //! Otherwise, evaluate() is invoked for each point.
+  virtual bool evaluateBatch(size_t nPt, unsigned short int nsd, size_t ncmp,
+                             RealArray& C, RealArray& sigma, RealArray& U,
+                             const FiniteElement* fe,
+                             const std::vector<const Vec3*>& X,
+                             const RealArray& F, const RealArray& eps,
+                             char iop = 1,
+                             const TimeDomain* prm = nullptr) const;
+
   //! \brief Returns number of internal result variables of the material model.
   virtual int getNoIntVariables() const { return 1; }
 
   //! \brief Returns an internal variable associated with the material model.
   //! \param[out] label Name of the internal variable (for result presentation)
-  virtual double getInternalVar(int, char* label, size_t) const;
+  //! \param[in] sigma Cauchy stress tensor at current point
+  //! \details The hydrostatic pressure is computed from the given stress
+  //! tensor, and is zero if no stress tensor is provided.
+  virtual double getInternalVar(int, char* label, size_t,
+                                const SymmTensor* sigma) const;
 
 protected:
   //! \brief Calculates Lame parameters from \a E and &nu;, or vice versa.
-  void findLameParams(double E = -1.0);
+  void findLameParams();
+  //! \brief Calculates Lame parameters from the given Young's modulus.
+  //! \param[in] E Young's modulus at current point
+  //! \param[out] kappa Bulk modulus (Lame parameter &lambda;)
+  //! \param[out] mu Shear modulus (Lame parameter &mu;)
+  void getLameParams(double E, double& kappa, double& mu) const;
 
   //! \brief Performs calculations for the standard NeoHookean material model.
   //! \param[in] J Determinant of deformation gradient
+  //! \param[in] kappa Bulk modulus at current point
+  //! \param[in] mu Shear modulus at current point
   //! \param S Left Cauchy-Green deformation tensor / Cauchy stress tensor
   //! \param[out] C Constitutive tensor
   //! \return Strain energy density
-  double stdNeoHooke(double J, SymmTensor& S, Matrix& C) const;
+  double stdNeoHooke(double J, double kappa, double mu,
+                     SymmTensor& S, Matrix& C) const;
 
   //! \brief Performs calculations for the modified NeoHookean material model.
   //! \param[in] J Determinant of deformation gradient
+  //! \param[in] kappa Bulk modulus at current point
+  //! \param[in] mu Shear modulus at current point
   //! \param S Left Cauchy-Green deformation tensor / Cauchy stress tensor
   //! \param[out] C Constitutive tensor
   //! \return Strain energy density
-  double modNeoHooke(double J, SymmTensor& S, Matrix& C) const;
+  double modNeoHooke(double J, double kappa, double mu,
+                     SymmTensor& S, Matrix& C) const;
 
   //! \brief Computes the volumetric material moduli.
   //! \param[in] J Determinant of deformation gradient
+  //! \param[in] kappa Bulk modulus at current point
   //! \param[out] U Strain energy density
   //! \param[out] Up Mean stress (pressure)
   //! \param[out] Upp Volumetric constitutive tensor
-  void volumetricModuli(double J, double& U, double& Up, double& Upp) const;
+  void volumetricModuli(double J, double kappa,
+                        double& U, double& Up, double& Upp) const;
 
 private:
   int    mVER; //!< Material version
   int    iVOL; //!< Volumetric option
   double Bmod; //!< Bulk modulus (Lame parameter &lambda;)
   double Smod; //!< Shear modulus (Lame parameter &mu;)
-
-  mutable double sigma_p; //!< Hydrostatic pressure at last evaluation point
 };
 
 #endif
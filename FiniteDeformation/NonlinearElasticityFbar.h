@@ -71,6 +71,15 @@ public:
   virtual bool evalInt(LocalIntegral& elmInt, const FiniteElement& fe,
 		       const TimeDomain& prm, const Vec3& X) const;
 
+  using NonlinearElasticityUL::finalizeElement;
+  //! \brief Finalizes the element quantities after the numerical integration.
+  //! \param elmInt The local integral object to receive the contributions
+  //! \param[in] fe Nodal and integration point data for current element
+  //! \param[in] prm Nonlinear solution algorithm parameters
+  //! \param[in] iGP Global integration point counter of first point in element
+  virtual bool finalizeElement(LocalIntegral& elmInt, const FiniteElement& fe,
+			       const TimeDomain& prm, size_t iGP);
+
   //! \brief Returns a pointer to an Integrand for solution norm evaluation.
   //! \note The Integrand object is allocated dynamically and has to be deleted
   //! manually when leaving the scope of the pointer variable receiving the
@@ -81,6 +90,23 @@ public:
   virtual int getReducedIntegration(int) const { return npt1; }
 
 private:
+  //! \brief Integrates the element quantities at an integration point.
+  //! \param fbar The element matrices to receive the contributions
+  //! \param[in] N Basis function values at the integration point
+  //! \param[in] X Cartesian coordinates of the integration point
+  //! \param[in] dNdx Basis function gradients in current configuration
+  //! \param[in] dMdx Modified basis function gradients
+  //! \param[in] M Modified basis function values (axisymmetric problems only)
+  //! \param Cmat The spatial constitutive matrix
+  //! \param Sig The Cauchy stress tensor
+  //! \param[in] detJW Integration point volume
+  //! \param[in] r Radial coordinate (axisymmetric problems only)
+  //! \param[in] lHaveStrains If \e false, there is no deformation yet
+  bool integratePoint(ElmMats& fbar, const Vector& N, const Vec3& X,
+		      const Matrix& dNdx, const Matrix& dMdx, const Vector& M,
+		      Matrix& Cmat, SymmTensor& Sig,
+		      double detJW, double r, bool lHaveStrains) const;
+
   int npt1; //!< Number of volumetric sampling points in each direction
 
   friend class ElasticityNormFbar;
@@ -60,6 +60,26 @@ public:
   //! the result point buffers.
   virtual void initResultPoints(double lambda, char prinDir);
 
+  //! \brief Defines all history-dependent materials of the model.
+  //! \details The history variables of these materials are initialized and
+  //! updated together with those of the current material, such that models
+  //! with more than one history-dependent material are handled consistently.
+  void setHistoryMaterials(const std::vector<Material*>& mats)
+  {
+    histMat = mats;
+  }
+
+  using Elasticity::initElement;
+  //! \brief Initializes current element for numerical integration.
+  //! \param[in] MNPC Matrix of nodal point correspondance for current element
+  //! \param[in] fe Nodal and integration point data for current element
+  //! \param[in] X0 Cartesian coordinates of the element center
+  //! \param[in] nPt Number of integration points in this element
+  //! \param elmInt Local integral for element
+  virtual bool initElement(const std::vector<int>& MNPC,
+                           const FiniteElement& fe, const Vec3& X0,
+                           size_t nPt, LocalIntegral& elmInt);
+
   using Elasticity::evalInt;
   //! \brief Evaluates the integrand at an interior point.
   //! \param elmInt The local integral object to receive the contributions
@@ -69,6 +89,19 @@ public:
   virtual bool evalInt(LocalIntegral& elmInt, const FiniteElement& fe,
                        const TimeDomain& prm, const Vec3& X) const;
 
+  using Elasticity::finalizeElement;
+  //! \brief Finalizes the element quantities after the numerical integration.
+  //! \param elmInt The local integral object to receive the contributions
+  //! \param[in] fe Nodal and integration point data for current element
+  //! \param[in] prm Nonlinear solution algorithm parameters
+  //! \param[in] iGP Global integration point counter of first point in element
+  //!
+  //! \details This method evaluates the constitutive relation for all
+  //! integration points of the element in one call, and then integrates
+  //! the material-dependent element matrices and vectors.
+  virtual bool finalizeElement(LocalIntegral& elmInt, const FiniteElement& fe,
+                               const TimeDomain& prm, size_t iGP);
+
   using Elasticity::evalBou;
   //! \brief Evaluates the integrand at a boundary point.
   //! \param elmInt The local integral object to receive the contributions
@@ -109,8 +142,26 @@ public:
   virtual bool diverged(size_t iP) const;
 
 private:
+  //! \brief Integrates the element quantities at an integration point.
+  //! \param elMat The element matrices to receive the contributions
+  //! \param[in] N Basis function values at the integration point
+  //! \param[in] X Cartesian coordinates of the integration point
+  //! \param[in] Bmat The strain-displacement matrix
+  //! \param[in] dNdx Basis function gradients in current configuration
+  //! \param[in] Cmat The constitutive matrix
+  //! \param sigma The Cauchy stress tensor
+  //! \param[in] detJW Integration point volume
+  //! \param[in] r Radial coordinate (axisymmetric problems only)
+  //! \param[in] lHaveStrains If \e false, there is no deformation yet
+  bool integratePoint(ElmMats& elMat, const Vector& N, const Vec3& X,
+                      const Matrix& Bmat, const Matrix& dNdx,
+                      const Matrix& Cmat, SymmTensor& sigma,
+                      double detJW, double r, bool lHaveStrains) const;
+
   char loadOp; //!< Load option
 
+  std::vector<Material*> histMat; //!< All history-dependent materials
+
   friend class ElasticityNormUL;
 };
 
@@ -15,6 +15,7 @@
 #define _NONLINEAR_ELASTICITY_UL_MX_H
 
 #include "NonlinearElasticityUL.h"
+#include <atomic>
 
 
 /*!
@@ -32,12 +33,28 @@ public:
   //! \param[in] pp Polynomial order of the pressure/volumetric-change field
   NonlinearElasticityULMX(unsigned short int n = 3,
 			  bool axS = false, int pp = 1);
-  //! \brief Empty destructor.
-  virtual ~NonlinearElasticityULMX() {}
+  //! \brief The destructor reports the usage of the Hh-matrix cache.
+  virtual ~NonlinearElasticityULMX();
+
+  //! \brief Parses a data section from an XML-element.
+  virtual bool parse(const tinyxml2::XMLElement* elem);
 
   //! \brief Prints out problem definition to the log stream.
   virtual void printLog() const;
 
+  //! \brief Allocates the cache of inverted Hh-matrices.
+  //! \param[in] nElms Total number of elements in the model
+  void initHiCache(size_t nElms);
+
+  using NonlinearElasticityUL::initIntegration;
+  //! \brief Initializes the integrand with the number of integration points.
+  //! \param[in] nGp Total number of interior integration points
+  //! \param[in] nBp Total number of boundary integration points
+  //!
+  //! \details This also invalidates the cached Hh-matrices,
+  //! since the reference configuration of the model may have changed.
+  virtual void initIntegration(size_t nGp, size_t nBp);
+
   using NonlinearElasticityUL::getLocalIntegral;
   //! \brief Returns a local integral container for the given element.
   //! \param[in] nen Number of nodes on element
@@ -89,6 +106,17 @@ public:
 private:
   int p; //!< Polynomial order of the internal pressure field
 
+  bool cacheHi; //!< If \e true, the inverted Hh-matrices are cached
+
+  //! \brief Inverted Hh-matrix for each element, indexed by the
+  //! element number (only used if \ref cacheHi is set)
+  //! \details The Hh-matrix depends on the reference configuration only.
+  //! An element with a non-empty entry therefore skips the integration and
+  //! inversion of the Hh-matrix, until the cache is invalidated.
+  std::vector<RealArray> myHi;
+
+  std::atomic<size_t> nInvH; //!< Number of Hh-matrix inversions performed
+
   friend class ElasticityNormULMX;
 };
 
@@ -15,9 +15,8 @@
 #define _PLASTIC_MATERIAL_H
 
 #include "MaterialBase.h"
+#include "MaterialHistory.h"
 #include "Tensor.h"
-#include "Vec3.h"
-#include <array>
 
 class PlasticMaterial;
 class ScalarFunc;
@@ -29,34 +28,42 @@ class ScalarFunc;
   \details
   The plasticity models have history variables at the integration points that
   need to be "remembered" from one iteration/increment to the next. This is
-  maintained inside this class as a vector of integration point objects, and
-  a global counter keeping track of which integration point we are calculating.
-  This counter is initialized in the beginning of each iteration, and then
-  incremented by each invokation of the evaluate() method. Therefore, it is
-  paramount that this method is invoked only once per integration point per
-  iteration, and in the same order in every iteration. Otherwise it will
-  output incorrect results.
-
-  A separate "integration point" vector is dedicated for results points.
+  maintained inside this class by a MaterialHistory object, storing the data
+  of all integration points in contiguous arrays, which are indexed by the
+  global integration point counter of the FiniteElement object.
+
+  A separate history database is dedicated for results points.
   This is needed because the results points (for visualization, etc.) are not
   the same as the integration points used in the tangent evaluation.
+  The result points are identified by a global counter which is initialized
+  in the beginning of each result point loop, and then incremented by each
+  invokation of the evaluate() method. Therefore, it is paramount that this
+  method is invoked only once per result point, and in the same order in every
+  loop. Otherwise it will output incorrect results.
 */
 
 class PlasticMaterial : public Material
 {
+  //! \brief Indices of the point fields in the history databases.
+  enum Fields
+  {
+    HV  = 0, //!< History variables (elastic left Cauchy-Green tensor, etc.)
+    FP  = 1, //!< Deformation gradient in previous configuration
+    ENE = 2, //!< Data for path integral of the strain energy density
+    SIG = 3  //!< Derived stress measures
+  };
+
   //! \brief Class representing an elasto-plastic material point.
+  //! \details This is a light-weight view of the data of one material point,
+  //! which is stored in a MaterialHistory object.
   class PlasticPoint
   {
   public:
     //! \brief Constructor initializing the material parameters.
-    //! \param[in] prm Pointer to actual material model object.
-    //! \param[in] n Number of space dimensions
-    PlasticPoint(const PlasticMaterial* prm, unsigned short int n);
-    //! \brief Empty destructor.
-    virtual ~PlasticPoint() {}
-
-    //! \brief Updates the internal history variables after convergence.
-    bool updateState(bool updateVars = true);
+    //! \param[in] prm Pointer to actual material model object
+    //! \param hist History database containing the point data
+    //! \param[in] iP 0-based index of this point in the database
+    PlasticPoint(const PlasticMaterial* prm, MaterialHistory& hist, size_t iP);
 
     //! \brief Evaluates the constitutive relation at this point.
     //! \param[out] C Constitutive matrix at current point
@@ -64,7 +71,7 @@ class PlasticMaterial : public Material
     //! \param[in] F Deformation gradient at current point
     //! \param[in] prm Nonlinear solution algorithm parameters
     int evaluate(Matrix& C, SymmTensor& sigma,
-                 const Tensor& F, const TimeDomain& prm) const;
+                 const Tensor& F, const TimeDomain& prm);
 
     //! \brief Updates the path integral of the strain energy density.
     //! \param[in] S Stress tensor at current configuration
@@ -72,11 +79,15 @@ class PlasticMaterial : public Material
     //! \return Updated strain energy density
     double energyIntegral(const SymmTensor& S, const SymmTensor& E);
 
-    //! \brief Returns a history variable.
-    double getVariable(size_t i) const { return HVc[i]; }
+    //! \brief Evaluates principal stresses at this point.
+    //! \param[in] sigma Stress tensor at current point
+    void principalStress(const SymmTensor& sigma);
 
-    //! \brief Returns whether this material point has diverged or not.
-    virtual bool diverged() const { return updated == 'd'; }
+    //! \brief Returns the deformation gradient of previous configuration.
+    //! \param[in] n Number of space dimensions
+    Tensor getFp(unsigned short int n) const;
+    //! \brief Updates the deformation gradient of previous configuration.
+    void setFp(const Tensor& F);
 
   protected:
     //! \brief Evaluates the yield function and its derivatives.
@@ -89,54 +100,21 @@ class PlasticMaterial : public Material
     const RealArray& pMAT; //!< Material property parameters
     const ScalarFunc* hfn; //!< Isotropic hardening function
 
-    using HistoryVars = std::array<double,10>; //!< History variable container
-
-    HistoryVars HVc; //!< History variable values in current configuration
-    HistoryVars HVp; //!< History variable values in previous configuration
-
-    char updated; //!< Flag indicating whether history variables are updated
+    double*       HVc; //!< History variable values in current configuration
+    const double* HVp; //!< History variable values in previous configuration
 
-    // Data for path integral of strain energy
-    SymmTensor Ep; //!< Strain tensor, previous configuration
-    SymmTensor Sp; //!< Stress tensor, previous configuration
-    double     Up; //!< Strain energy density
+    char& updated; //!< Flag indicating whether history variables are updated
 
-  public:
-    Tensor Fp; //!< Deformation gradient, previous configuration
-  };
-
-  //! \brief Class representing an elasto-plastic result point.
-  class ResultPoint : public PlasticPoint
-  {
-  public:
-    //! \brief Constructor initializing the material parameters.
-    //! \param[in] prm Pointer to actual material model object.
-    //! \param[in] n Number of space dimensions
-    ResultPoint(const PlasticMaterial* prm, unsigned short int n);
-
-    //! \brief Evaluates principal stresses at this point.
-    //! \param[in] sigma Stress tensor at current point
-    void principalStress(const SymmTensor& sigma);
-
-    //! \brief Returns the mean stress:
-    double getMeanStress() const { return sigma_h; }
-    //! \brief Returns the principal stress.
-    double getPrnStress(size_t i = 0) const { return prin[i]; }
-    //! \brief Returns the stress triaxiality.
-    double getTriax() const;
-    //! \brief Returns the Lode parameter.
-    double getLode() const;
-
-  private:
-    double sigma_h; //!< Mean stress
-    double sigma_e; //!< von Mises stress
-    Vec3   prin;    //!< Principal stresses
+    double* Fp;  //!< Deformation gradient, previous configuration (3x3)
+    double* Edt; //!< Stress and strain tensor, previous configuration, and
+                 //!< strain energy density
+    double* Sdt; //!< Mean stress, von Mises stress and principal stresses
   };
 
 public:
   //! \brief Constructor initializing the material parameters.
   PlasticMaterial(const RealArray& p, const ScalarFunc* hcurve = nullptr);
-  //! \brief The destructor frees the dynamically allocated data.
+  //! \brief The destructor frees the hardening function.
   virtual ~PlasticMaterial();
 
   //! \brief Prints out material parameters to the log stream.
@@ -184,6 +162,15 @@ public:
                         char iop, const TimeDomain* prm,
                         const Tensor* Fpf = nullptr) const;
 
+  //! \brief Discards the non-converged state of the history variables.
+  virtual void rollback() { itgData.rollback(); }
+
+  //! \brief Serializes the history variables of the integration and result
+  //! points into a binary string.
+  virtual bool serialize(std::string& data) const;
+  //! \brief Restores the converged history variables from serialized data.
+  virtual bool deSerialize(const std::string& data);
+
   //! \brief Returns whether the material model has diverged.
   //! \param[in] iP1 Global (1-based) index for the integration point to check,
   //! checking all points if \a iP1 is zero
@@ -196,7 +183,8 @@ public:
   //! \param[in] idx Index (1-based) of the internal variable
   //! \param[out] label Name of the internal variable (for result presentation)
   //! \param[in] iP1 Global (1-based) index for current point
-  virtual double getInternalVar(int idx, char* label, size_t iP1) const;
+  virtual double getInternalVar(int idx, char* label, size_t iP1,
+                                const SymmTensor*) const;
 
 private:
   RealArray pMAT; //!< Material property parameters
@@ -206,9 +194,12 @@ private:
   bool iAmIntegrating; //!< Flag indicating integration or result evaluation
   bool firstStep;      //!< \e true when we are doing the first time step
 
-  mutable size_t                    iP2;       //!< Global result point counter
-  mutable std::vector<ResultPoint*> itgPoints; //!< Integration point data
-  mutable std::vector<ResultPoint*> resPoints; //!< Result point data
+  //! \brief Registers the point fields of a history database.
+  static void defineFields(MaterialHistory& data);
+
+  mutable size_t          iP2;     //!< Global result point counter
+  mutable MaterialHistory itgData; //!< Integration point data
+  mutable MaterialHistory resData; //!< Result point data
 };
 
 #endif
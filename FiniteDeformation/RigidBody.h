@@ -73,6 +73,16 @@ public:
   virtual void geometricStiffness(const Vec3& X, Vec3& normal,
 				  Matrix& Tg, RealArray& N) const = 0;
 
+  //! \brief Returns a lower bound of the gap function within a sphere.
+  //! \param[in] X Cartesian coordinates of the sphere center
+  //! \param[in] r Radius of the sphere
+  //!
+  //! \details The default implementation assumes that the gap function is
+  //! the (signed) distance to the rigid surface, which changes at most by
+  //! the distance moved. Bodies with a more expensive gap function, such as
+  //! triangulated surfaces, may override this with a faster bound.
+  virtual double gapBound(const Vec3& X, double r) const;
+
   //! \brief Returns the number of internal nodes.
   size_t getNoNodes() const { return MLGN.size(); }
 
@@ -80,12 +90,52 @@ public:
   //! \param[in] inod 1-based node index local to current body
   int getNodeID(size_t inod) const { return MLGN[inod-1]; }
 
+  //! \brief Adds a slave element to the broad-phase contact search.
+  //! \param[in] iel Global element number
+  //! \param[in] nodes Global node numbers of the slave surface nodes
+  //! \param[in] X Initial coordinates of the slave surface nodes
+  void addSlaveElement(int iel, const std::vector<int>& nodes,
+                       const std::vector<Vec3>& X);
+  //! \brief Updates the contact candidate status of the slave elements.
+  //! \param[in] displ Total displacement vector of the whole FE model
+  //!
+  //! \details A slave element is a contact candidate unless all its slave
+  //! nodes are connected to elements only, whose bounding spheres are
+  //! separated from the rigid surface. Skipping the other elements will then
+  //! only remove slave nodes that would not be active anyway, assuming that
+  //! the elements are within the convex hull of their nodes. This holds for
+  //! spline and linear Lagrange elements, but not for higher-order Lagrange
+  //! elements, which therefore must not be added to the broad-phase search.
+  //! \return \e true if the number of contact candidates changed
+  bool updateCandidates(const RealArray& displ);
+  //! \brief Returns the number of slave elements that are contact candidates.
+  size_t getNoCandidates() const { return nCand; }
+  //! \brief Returns the total number of slave elements of this body.
+  size_t getNoSlaveElms() const { return slaveElms.size(); }
+  //! \brief Returns \e false if a slave element is out of contact.
+  //! \param[in] iel Global element number
+  bool isCandidate(int iel) const;
+
 protected:
   std::vector<Vec3> X0;   //!< Initial coordinates of the internal points
   std::vector<Vec3> Xn;   //!< Updated coordinates of the internal points
   std::vector<int>  MLGN; //!< Matrix of Local to Global Node numbers
   unsigned char     nsd;  //!< Number of space dimensions
 
+private:
+  //! \brief Struct with broad-phase contact data of a slave element.
+  struct SlaveElm
+  {
+    std::vector<size_t> nodes; //!< Slave node indices of this element
+    bool            candidate; //!< If \e false, the element is out of contact
+  };
+
+  std::map<int,size_t>   slaveIdx;  //!< Global-to-local slave node numbers
+  std::vector<int>       slaveNod;  //!< Global node numbers of slave nodes
+  std::vector<Vec3>      slaveX0;   //!< Initial slave node coordinates
+  std::map<int,SlaveElm> slaveElms; //!< Slave elements of this body
+  size_t                 nCand;     //!< Number of contact candidate elements
+
 public:
   double eps;    //!< Penalty parameter for the contact constraint of this body
   int    code;   //!< Property code associated with this contact body
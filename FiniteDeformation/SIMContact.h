@@ -48,7 +48,7 @@ class SIMContact
 
 protected:
   //! \brief The default constructor is protected to allow sub-classes only.
-  SIMContact() : contactMethod(NONE) {}
+  SIMContact() : contactMethod(NONE), broadPhase(false) {}
   //! \brief The destructor deletes the rigid body objects and scalar functions.
   virtual ~SIMContact();
 
@@ -106,7 +106,10 @@ protected:
   //! \param itgs All integrands of the contact problem (including the main one)
   //! \param[in] sam Auxiliary data for FE assembly management
   //! \param[in] nsd Number of space dimensions
-  bool preprocessContact(IntegrandMap& itgs, const SAM& sam, size_t nsd);
+  //! \param[in] splines If \e true, the FE model is spline-based, otherwise
+  //! it is assumed to consist of Lagrange (or spectral) elements
+  bool preprocessContact(IntegrandMap& itgs, const SAM& sam, size_t nsd,
+                         bool splines);
 
   //! \brief Updates time-dependent in-homogeneous Dirichlet coefficients.
   //! \param[in] time Current time
@@ -117,6 +120,10 @@ protected:
   void renumberContactBodies(const std::map<int,int>& old2new);
   //! \brief Updates the positions of the contact bodies.
   //! \param[in] displ Current total displacement vector in DOF order
+  //!
+  //! \details This also updates the broad-phase contact search, such that
+  //! slave elements that are clearly out of contact are skipped in the
+  //! subsequent integration of the Mortar matrices.
   bool updateContactBodies(const std::vector<double>& displ);
 
   //! \brief Assembles contributions to the tangent stiffness and residual.
@@ -151,11 +158,13 @@ protected:
 
 private:
   std::vector<RigidBody*>    myBodies; //!< All rigid bodies of the model
+  std::vector<ContactPair>   myPairs;  //!< All rigid/flexible contact pairs
   std::vector<ScalarFunc*>   myFuncs;  //!< Functions for prescribed movements
   std::map<MPC*,ScalarFunc*> dMap;     //!< MPC equation to functions map
   std::map<int,int>          myALp;    //!< Augmented Lagrange multiplier map
 
   Method contactMethod; //!< Contact formulation option
+  bool   broadPhase;    //!< If \e true, skip slave elements out of contact
 };
 
 #endif
@@ -76,6 +76,18 @@ public:
   //! \param[in] tangent If \e true, use time-derivatives of prescribed values
   bool updateDirichlet(double time, const Vector* prevSol, bool tangent) override;
 
+  //! \brief Discards the non-converged state of the material history.
+  //! \details This method is invoked on load step cut-back. It rolls back
+  //! all history-dependent materials of the model, not only the current one.
+  void rollbackHistory() override;
+
+  //! \brief Serializes the material history variables for restarting purposes.
+  //! \param data Container for serialized data
+  bool serialize(std::map<std::string,std::string>& data) const override;
+  //! \brief Restores the material history variables from serialized data.
+  //! \param[in] data Container for serialized data
+  bool deSerialize(const std::map<std::string,std::string>& data) override;
+
   //! \brief Updates Problem-dependent state based on current solution.
   //! \param[in] solution Current primary solution vector
   bool updateConfiguration(const Vector& solution) override;
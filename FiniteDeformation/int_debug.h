@@ -17,8 +17,6 @@
 #endif
 #endif
 
-#ifdef USE_FTNMAT
 #ifndef INT_DEBUG
 #define INT_DEBUG 0
 #endif
-#endif
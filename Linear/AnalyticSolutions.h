@@ -16,6 +16,7 @@
 
 #include "TensorFunction.h"
 #include "AnaSol.h"
+#include <memory>
 
 
 /*!
@@ -206,17 +207,53 @@ protected:
 
 class NavierPlate : public ThinPlateSol, private STensorFunc
 {
+  /*!
+    \brief Nested struct with the point-independent Fourier series data.
+    \details The double sums of the plate solution are evaluated separably.
+    The sine and cosine values of all terms in each direction are tabulated
+    by Chebyshev recurrence, followed by a contraction with the coefficient
+    matrix, which is precomputed for all terms.
+  */
+  struct Series
+  {
+    double alpha; //!< pi/(plate length)
+    double beta;  //!< pi/(plate width)
+    int    inc;   //!< Increment in Fourier term summation (1 or 2)
+    size_t nT;    //!< Number of terms in each direction
+    size_t nW;    //!< Number of terms in each direction for the displacement
+    double wScl;  //!< Scaling factor of the displacement series
+
+    std::vector<double> am; //!< Term frequencies in X-direction, alpha*m
+    std::vector<double> bn; //!< Term frequencies in Y-direction, beta*n
+    //! Term coefficients pz_mn/(am^2+bn^2)^2, stored row-wise
+    std::vector<double> K;
+    //! Term coefficients pz_mn/(am^2+bn^2)^2, stored column-wise
+    std::vector<double> Kt;
+
+    //! \brief Tabulates the sine and cosine of all terms in one direction.
+    //! \param[in] w Base frequency of the direction (\a alpha or \a beta)
+    //! \param[in] x Coordinate of the point in this direction
+    //! \param[in] n Number of terms to tabulate
+    //! \param[out] s Sine values of each term
+    //! \param[out] c Cosine values of each term (nullptr if not needed)
+    void tabulate(double w, double x, size_t n, double* s, double* c) const;
+    //! \brief Evaluates the displacement series at a batch of points.
+    //! \param[in] X Cartesian coordinates of the points
+    //! \param[in] nP Number of points
+    //! \param[out] w Displacement values at each point
+    void displ(const Vec3* X, size_t nP, double* w) const;
+  };
+
+  typedef std::shared_ptr<const Series> SeriesPtr; //!< Series data pointer
+
   /*!
     \brief Nested class representing the analytic displacement field.
   */
   class Displ : public RealFunc
   {
   public:
-    //! \brief The constructor initializes the problem parameters.
-    Displ(double p, double a, double b, double x, double y,
-          double c, double d, char t, int n, int i)
-      : pzD(p), alpha(a), beta(b), xi(x), eta(y), c2(c), d2(d),
-        type(t), mn(t > 0 ? n : n-1), inc(i) {}
+    //! \brief The constructor initializes the series data pointer.
+    explicit Displ(const SeriesPtr& s) : series(s) {}
     //! \brief Empty destructor.
     virtual ~Displ() {}
 
@@ -225,17 +262,7 @@ class NavierPlate : public ThinPlateSol, private STensorFunc
     virtual double evaluate(const Vec3& X) const;
 
   private:
-    double pzD;   //!< Load parameter (pz/D)
-    double alpha; //!< pi/(plate length)
-    double beta;  //!< pi/(plate width)
-
-    double xi;   //!< X-position of point/partial load
-    double eta;  //!< Y-position of point/partial load
-    double c2;   //!< Partial load extension in X-direction
-    double d2;   //!< Partial load extension in Y-direction
-    char   type; //!< Load type parameter (0, 1, or 2)
-    int    mn;   //!< Number of terms in Fourier series in each direction
-    int    inc;  //!< Increment in Fourier term summation (1 or 2)
+    SeriesPtr series; //!< Fourier series data of the plate solution
   };
 
 public:
@@ -260,11 +287,16 @@ protected:
   //! \brief Evaluates the solution/derivative at the point \a X.
   SymmTensor evaluate(const Vec3& X, int deriv) const;
 
-  //! \brief Adds the m'th and n'th terms of the plate solution to the moments.
-  void addTerms(std::vector<double>& M, double x, double y,
-                int m, int n, int deriv) const;
-
 private:
+  //! \brief Sets up the Fourier series data of the plate solution.
+  void initSeries();
+  //! \brief Evaluates the solution/derivative at a batch of points.
+  //! \param[in] X Cartesian coordinates of the points
+  //! \param[in] nP Number of points
+  //! \param M Stress resultant tensors (or derivatives), initially zero
+  //! \param[in] deriv Derivative index (0 for the stress resultants)
+  void moments(const Vec3* X, size_t nP, SymmTensor* M, int deriv) const;
+
   double alpha; //!< pi/(plate length)
   double beta;  //!< pi/(plate width)
   double pz;    //!< Load parameter
@@ -276,6 +308,8 @@ private:
   double d2;   //!< Partial load extension in Y-direction
   int    mxmn; //!< Max number of terms in Fourier series in each direction
   int    inc;  //!< Increment in Fourier term summation (1 or 2)
+
+  SeriesPtr series; //!< Fourier series data of the plate solution
 };
 
 
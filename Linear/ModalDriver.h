@@ -18,6 +18,8 @@
 #include "NewmarkSIM.h"
 #include "EigenModeSIM.h"
 
+class ModalLoad;
+
 
 /*!
   \brief Driver for modal analysis of linear dynamic problems.
@@ -27,14 +29,15 @@ class ModalDriver : public NewmarkDriver<NewmarkSIM>
 {
 public:
   //! \brief The constructor forwards to the parent class constructor.
-  explicit ModalDriver(SIMbase& sim, bool qs = false)
-    : NewmarkDriver<NewmarkSIM>(sim) { qstatic = qs; }
+  explicit ModalDriver(SIMbase& sim, bool qs = false);
 
   //! \brief Prints out problem-specific data to the log stream.
   //! \param[in] stopInputTimer If \e true, stop file input timer before print
   virtual void printProblem(bool stopInputTimer) const;
 
   //! \brief Calculates/returns the current real solution vectors.
+  //! \param[in] returnCurrent If \e false, a new time step has been solved
+  //! on the modal equation system
   virtual const Vectors& realSolutions(bool returnCurrent);
   //! \brief Returns a const reference to the current real solution vector.
   virtual const Vector& realSolution(int i = 0) const;
@@ -53,6 +56,22 @@ public:
   //! \brief Dumps the projected secondary solution for the eigenmodes.
   void dumpModes(utl::LogStream& os, std::streamsize precision) const;
 
+  //! \brief Solves the modal equations for current time step.
+  //! \param param Time stepping parameters
+  //! \param[in] mode Solution mode
+  //! \param[in] zero_tolerance Truncate norm values smaller than this to zero
+  //! \param[in] outPrec Number of digits after the decimal point in norm print
+  //!
+  //! \details If the external load is separable in space and time, the load
+  //! vector is neither assembled nor projected when its modal participation
+  //! factors have been established. All the uncoupled modal equations are then
+  //! integrated in one Newmark recurrence instead, without the modal equation
+  //! system and the predictor/multi-corrector iterations. The expansion to the
+  //! physical DOFs is deferred until the real solution actually is needed.
+  virtual SIM::ConvStatus solveStep(TimeStep& param, SIM::SolutionMode mode,
+                                    double zero_tolerance,
+                                    std::streamsize outPrec);
+
   //! \brief Checks whether the corrector iterations have converged or diverged.
   SIM::ConvStatus checkConvergence(TimeStep& tp);
   //! \brief Calculates predicted velocities and accelerations.
@@ -61,7 +80,15 @@ public:
   virtual bool correctStep(TimeStep& tp, bool);
 
 private:
+  //! \brief Integrates all modal equations over the time step.
+  //! \param[in] time Time domain data of current time step
+  void integrateModes(const TimeDomain& time);
+
   bool qstatic; //!< If \e true, use quasi-static simulation driver
+
+  const ModalLoad* sepLoad; //!< Separable external load, if any
+
+  mutable bool expanded; //!< If \e true, the real solution is up to date
 };
 
 
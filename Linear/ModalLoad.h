@@ -0,0 +1,91 @@
+// $Id$
+//==============================================================================
+//!
+//! \file ModalLoad.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author Knut Morten Okstad / SINTEF
+//!
+//! \brief Modal participation of a separable external load.
+//!
+//==============================================================================
+
+#ifndef _MODAL_LOAD_H
+#define _MODAL_LOAD_H
+
+#include "MatVec.h"
+
+class ScalarFunc;
+class SystemVector;
+struct Mode;
+namespace tinyxml2 { class XMLElement; }
+
+
+/*!
+  \brief Class representing an external load that is separable in space and
+  time, projected onto the eigenmodes of a modal dynamics simulation.
+  \details The load is given by a fixed spatial distribution scaled by the
+  time function \ref loadFunc. The modal participation factors of the spatial
+  distribution are computed once, from the first load vector assembled at a
+  time with a non-zero function value. The load vector is then assembled once
+  more, at the next time with a non-zero function value, to verify that it
+  really is separable with the given time function. The modal load vector of
+  the subsequent time steps is obtained by scaling the participation factors
+  only, such that neither assembly nor projection of the physical load is
+  needed.
+*/
+
+class ModalLoad
+{
+public:
+  //! \brief Default constructor.
+  ModalLoad() : loadFunc(nullptr), checked(false) {}
+  //! \brief Disable the copy constructor.
+  ModalLoad(const ModalLoad&) = delete;
+  //! \brief The destructor deletes the load scaling function.
+  ~ModalLoad();
+
+  //! \brief Disable the assignment operator.
+  ModalLoad& operator=(const ModalLoad&) = delete;
+
+  //! \brief Parses the load scaling function from the \a newmarksolver tag.
+  void parse(const tinyxml2::XMLElement* elem);
+
+  //! \brief Returns \e true if the modal participation factors are computed.
+  bool active() const { return !Fmod.empty(); }
+  //! \brief Returns \e true if the load has been verified to be separable.
+  bool ready() const { return checked; }
+
+  //! \brief Computes the modal participation factors of the load.
+  //! \param R The physical load vector at time \a t, cleared on output
+  //! if the participation factors were computed
+  //! \param[in] modes The eigenmodes to project onto
+  //! \param[in] t Current time
+  //! \return \e false if the load is not separable with the time function
+  //!
+  //! \details Nothing is done if no load scaling function is defined,
+  //! or if its value at time \a t is zero. If the participation factors
+  //! already are computed, the load vector \a R is used to verify them.
+  bool project(Vector& R, const std::vector<Mode>& modes, double t);
+
+  //! \brief Adds the scaled modal load to the right-hand-side vector.
+  //! \param Rmod Right-hand-side vector of the modal equation system
+  //! \param[in] t Current time
+  bool addTo(SystemVector* Rmod, double t) const;
+
+  //! \brief Returns the modal participation factors, for unit scaling.
+  const Vector& getFactors() const { return Fmod; }
+  //! \brief Returns the squared angular eigenfrequencies.
+  const Vector& getOmega2() const { return omega2; }
+  //! \brief Evaluates the load scaling function at time \a t.
+  double getScale(double t) const;
+
+private:
+  ScalarFunc* loadFunc; //!< Time function of separable external load
+  Vector      Fmod;     //!< Modal participation factors, for unit scaling
+  Vector      omega2;   //!< Squared angular eigenfrequencies
+  bool        checked;  //!< If \e true, the load is verified to be separable
+};
+
+#endif
@@ -27,11 +27,14 @@ class SIMoutput;
   \param[in] dumpNodeMap If \e true, export node mapping to HDF5 file
   \param[in] zero_tol Truncate result values smaller than this to zero
   \param[in] outPrec Number of digits after the decimal point in result print
+  \param[in] factorOnce If \e true, assemble and factorize the stiffness
+  matrix only once, and reuse it for all the subsequent load cases
   \return Exit status
 */
 
 int mlcSim (char* infile, SIMoutput* model,
             bool fixDup = false, bool dumpNodeMap = false,
-            double zero_tol = 1.0e-8, std::streamsize outPrec = 6);
+            double zero_tol = 1.0e-8, std::streamsize outPrec = 6,
+            bool factorOnce = false);
 
 #endif
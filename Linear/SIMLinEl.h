@@ -44,6 +44,8 @@ public:
   {
     if (sid) supSC = sid;
     dualS = ds;
+    lhsDt = 0.0;
+    reuseLHS = true;
   }
   //! \brief Constructor for coupled multi-dimensional simulators.
   //! \param[in] head Header identifying this sub-simulator.
@@ -52,11 +54,49 @@ public:
   {
     Dim::myHeading = head;
     dualS = false;
+    lhsDt = 0.0;
+    reuseLHS = true;
   }
 
   //! \brief Empty destructor.
   virtual ~SIMLinEl() {}
 
+  using SIMElasticity<Dim>::assembleSystem;
+  //! \brief Administers assembly of the linear equation system.
+  //! \param[in] time Parameters for time-dependent simulations
+  //! \param[in] prevSol Previous primary solution vectors in DOF-order
+  //! \param[in] newLHSmatrix If \e false, only integrate the RHS vector
+  //! \param[in] poorConvg If \e true, the nonlinear driver is converging poorly
+  //!
+  //! \details This overloaded version reuses the coefficient matrix in linear
+  //! dynamics simulations with a constant time step size. The Newmark matrix
+  //! is then assembled (and factorized) in the first iteration only, whereas
+  //! only the right-hand-side vector is assembled in the subsequent iterations
+  //! and time steps. It falls back to a full assembly whenever the time step
+  //! size changes, or when element activation is used. The matrix reuse is
+  //! switched off by specifying \a reuseLHS="false" on the model tag.
+  virtual bool assembleSystem(const TimeDomain& time, const Vectors& prevSol,
+                              bool newLHSmatrix, bool poorConvg)
+  {
+    if (!newLHSmatrix || !Dim::myProblem)
+      return this->Dim::assembleSystem(time,prevSol,newLHSmatrix,poorConvg);
+    else if (Dim::myProblem->getMode() != SIM::DYNAMIC ||
+             this->hasElementActivator() || !reuseLHS)
+      lhsDt = 0.0; // The coefficient matrix is (or will be) overwritten
+    else if (time.dt > 0.0 && time.dt == lhsDt)
+    {
+      // The current coefficient matrix is still valid, assemble the RHS only
+      this->setMode(SIM::RHS_ONLY);
+      bool ok = this->Dim::assembleSystem(time,prevSol,false,poorConvg);
+      this->setMode(SIM::DYNAMIC);
+      return ok;
+    }
+    else
+      lhsDt = time.dt;
+
+    return this->Dim::assembleSystem(time,prevSol,true,poorConvg);
+  }
+
   using SIMElasticity<Dim>::solveSystem;
   //! \brief Solves the assembled linear system of equations for a given load.
   //! \param[out] solution Global primary solution vector
@@ -292,6 +332,10 @@ protected:
     // Check for static condensation
     const tinyxml2::XMLElement* sctag = nullptr;
     if (!strcasecmp(elem->Value(),SIMElasticity<Dim>::myContext.c_str()))
+    {
+      if (utl::getAttribute(elem,"reuseLHS",reuseLHS) && !reuseLHS)
+        IFEM::cout <<"\tThe coefficient matrix is reassembled in all steps"
+                   << std::endl;
       for (const tinyxml2::XMLElement* child = elem->FirstChildElement();
            child; child = child->NextSiblingElement())
         if (!strcasecmp(child->Value(),"staticCondensation"))
@@ -304,6 +348,7 @@ protected:
               IFEM::cout <<"\tIgnoring superelement \""<< id <<"\""<< std::endl;
               return true;
             }
+    }
 
     if (!this->SIMElasticity<Dim>::parse(elem))
       return false;
@@ -366,6 +411,9 @@ private:
   //! - = 's' : Perform a modal dynamics simulation
   char dualS;
 
+  double lhsDt;    //!< Time step size of the assembled Newmark matrix
+  bool   reuseLHS; //!< If \e false, always reassemble the Newmark matrix
+
   RealArray myReact;  //!< Nodal reaction forces
   Vector    myForces; //!< Internal forces in boundary nodes
 
@@ -16,6 +16,7 @@
 
 #include "SIMLinEl.h"
 #include "SIMmodal.h"
+#include "ModalLoad.h"
 
 
 /*!
@@ -47,6 +48,12 @@ public:
   //! AlgEqSystem object (and an associated SAM object), and the pointers to
   //! those modal objects are swapped with the original ones depending on which
   //! system we are currently working on.
+  //!
+  //! If the external load is separable in space and time, its modal
+  //! participation factors are computed from the first non-zero load vector,
+  //! and verified by the second one. The modal load vector of the subsequent
+  //! time steps is then obtained by scaling these factors only,
+  //! see the ModalLoad class.
   virtual bool assembleSystem(const TimeDomain& time,
                               const Vectors& mSol, bool, bool)
   {
@@ -58,7 +65,7 @@ public:
       // Swap back to the full equation system for assembly of load vector
       this->swapSystem(Dim::myEqSys,Dim::mySam);
 
-    else
+    else if (!sepLoad.ready())
     {
       // Assemble the load vector of this time step.
       // We need to do this in the first iteration only, as for linear systems
@@ -69,6 +76,10 @@ public:
       // Extract the load vector in DOF-order
       if (!this->Dim::extractLoadVec(Rhs))
         return false;
+
+      // Compute the modal participation of a separable load
+      if (!sepLoad.project(Rhs,myModes,time.t))
+        return false;
     }
 
     // Assemble the modal equation system
@@ -79,7 +90,11 @@ public:
 
     // Swap the equation systems such that the dynamic simulation driver
     // operates on the modal system
-    return this->swapSystem(Dim::myEqSys,Dim::mySam);
+    if (!this->swapSystem(Dim::myEqSys,Dim::mySam))
+      return false;
+
+    // Add the scaled modal load, if separable
+    return !sepLoad.active() || sepLoad.addTo(Dim::myEqSys->getVector(),time.t);
   }
 
   using SIMmodal::expandSolution;
@@ -96,6 +111,9 @@ public:
     return this->expandSolution(mSol);
   }
 
+  //! \brief Returns the separable external load.
+  const ModalLoad& getSeparableLoad() const { return sepLoad; }
+
   //! \brief Serialization support, for the eigenmodes.
   virtual bool serialize(std::map<std::string,std::string>& data) const
   {
@@ -135,6 +153,9 @@ protected:
   //! during the second time parsing for the time integration setup only.
   virtual bool parse(const tinyxml2::XMLElement* elem)
   {
+    if (!strcasecmp(elem->Value(),"newmarksolver"))
+      sepLoad.parse(elem); // Check for separable external load
+
     return this->parseParams(elem) || this->SIMLinEl<Dim>::parse(elem);
   }
 
@@ -150,6 +171,9 @@ protected:
     this->setIntegrationPrm(1,alpha2);
     return this->SIMLinEl<Dim>::preprocessB();
   }
+
+private:
+  ModalLoad sepLoad; //!< Modal participation of separable external load
 };
 
 #endif
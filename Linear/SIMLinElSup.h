@@ -31,6 +31,32 @@ public:
   //! \brief The destructor deletes the FE substructure data.
   virtual ~SIMLinElSup();
 
+  //! \brief Inserts the nodal vector of an instance into an interleaved vector.
+  //! \param[in] vec Nodal vector of instance \a k, \a ncmp values per node
+  //! \param[in] k Zero-based instance index
+  //! \param[in] nInst Number of instances in the interleaved vector
+  //! \param[in] ncmp Number of nodal components of each instance
+  //! \param allvec Nodal vector with \a ncmp*nInst values per node
+  static bool interleave(const Vector& vec, size_t k, size_t nInst,
+                         size_t ncmp, Vector& allvec);
+  //! \brief Appends the field of an instance from an interleaved field.
+  //! \param[in] allfield Field with \a ncmp*nInst rows
+  //! \param[in] k Zero-based instance index
+  //! \param[in] ncmp Number of field components of each instance
+  //! \param field Field of instance \a k, with \a ncmp rows
+  static void deinterleave(const Matrix& allfield, size_t k, size_t ncmp,
+                           Matrix& field);
+  //! \brief Evaluates the solution fields of several instances of a patch.
+  //! \param[in] pch The patch to evaluate the solution fields for
+  //! \param[in] sols Global solution vector of each instance
+  //! \param[in] madof Matrix of accumulated DOFs per node
+  //! \param[in] nViz Number of visualization points over each knot-span
+  //! \param fields Solution field of each instance, appended to
+  static bool evalPatchFields(const ASMbase* pch,
+                              const std::vector<const Vector*>& sols,
+                              const int* madof, const int* nViz,
+                              const std::vector<Matrix*>& fields);
+
 protected:
   using SIMsupel::parse;
   //! \brief Parses a data section from an XML element
@@ -63,6 +89,13 @@ protected:
                          double, int idBlock, int);
 
 private:
+  //! \brief Evaluates the internal displacement fields of some superelements.
+  //! \param[in] p0 Index of the first superelement to evaluate
+  //! \param[out] fields Displacement field at the visualization points
+  //! of superelements \a p0, \a p0+1, ... (untouched for superelements
+  //! without FE model)
+  bool evalInternalDispl(size_t p0, std::vector<Matrix>& fields) const;
+
   //! \brief Struct representing a FE substructure.
   struct FEmodel
   {
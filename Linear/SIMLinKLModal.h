@@ -16,6 +16,7 @@
 
 #include "SIMLinElKL.h"
 #include "SIMmodal.h"
+#include "ModalLoad.h"
 
 
 /*!
@@ -47,6 +48,10 @@ public:
   //! AlgEqSystem object (and an associated SAM object), and the pointers to
   //! those modal objects are swapped with the original ones depending on which
   //! system we are currently working on.
+  //!
+  //! If the external load is separable in space and time, its modal
+  //! participation factors are computed from the first non-zero load vector,
+  //! verified by the second one, and only scaled in the subsequent time steps.
   virtual bool assembleSystem(const TimeDomain& time,
                               const Vectors& mSol, bool, bool);
 
@@ -56,6 +61,9 @@ public:
   //! \param[in] swapBck If \e true, the equation systems are swapped
   virtual const Vectors& expandSolution(const Vectors& mSol, bool swapBck);
 
+  //! \brief Returns the separable external load.
+  const ModalLoad& getSeparableLoad() const { return sepLoad; }
+
   //! \brief Serialization support, for the eigenmodes.
   virtual bool serialize(std::map<std::string,std::string>& data) const;
   //! \brief Deserialization support (for simulation restart).
@@ -82,6 +90,9 @@ protected:
   //! such that the model parsing is skipped when the input file is parsed
   //! for the second time while doing the time integration setup.
   virtual bool preprocessB();
+
+private:
+  ModalLoad sepLoad; //!< Modal participation of separable external load
 };
 
 #endif
@@ -15,6 +15,7 @@
 #define _SIM_MC_STATIC_H_
 
 #include "SIMmultiCpl.h"
+#include "MatVec.h"
 
 class DataExporter;
 
@@ -30,13 +31,45 @@ public:
   explicit SIMmcStatic(const std::vector<SIMoutput*>& sims) : SIMmultiCpl(sims)
   {
     myHeading = "Coupled linear static solver";
+    concurrent = false;
   }
   //! \brief Empty destructor.
   virtual ~SIMmcStatic() {}
 
+  //! \brief Toggles concurrent assembly and recovery of the sub-simulators.
+  void setConcurrent(bool onOff) { concurrent = onOff; }
+
   //! \brief Solves a linear static fully coupled multi-simulator problem.
   int solveStatic(const char* inpfile, DataExporter* exporter,
                   double zero_tol, int outPrec);
+
+private:
+  //! \brief Checks if the sub-simulators can be assembled concurrently.
+  //! \details This requires more than one thread, a matrix format
+  //! for which the private equation systems can be added together,
+  //! and that none of the sub-simulators use local coordinate systems.
+  //! Otherwise, the sequential assembly is used.
+  bool canAssembleConcurrent() const;
+  //! \brief Assembles the sub-simulators concurrently.
+  //! \param substep Sub-step counter for the heading printout
+  //! \details Each sub-simulator assembles into its own equation system,
+  //! which are added into the shared system of the first sub-simulator
+  //! afterwards. The available threads are divided among the sub-simulators.
+  //! The output of the sub-simulators is buffered, and printed in sequence.
+  bool assembleConcurrent(int& substep);
+  //! \brief Prints the result point values of the sub-simulators.
+  //! \param[in] displ Solution vector of the coupled system
+  //! \param[in] zero_tol Zero tolerance for printing of result values
+  //! \param[in] outPrec Number of digits after the decimal point
+  //! \param substep Sub-step counter for the heading printout
+  //! \details In concurrent mode, the result points of all sub-simulators
+  //! are evaluated in parallel into separate buffers, which then are printed
+  //! in the order of the sub-simulators. This is not done if any of them
+  //! uses a local coordinate system for the result output.
+  void dumpResults(const Vector& displ, double zero_tol, int outPrec,
+                   int& substep);
+
+  bool concurrent; //!< If \e true, handle the sub-simulators concurrently
 };
 
 #endif
@@ -0,0 +1,41 @@
+# $Id$
+# This script runs a simulation with two different input files,
+# and checks that the printed time step results are identical.
+# Usage: cmake -DEXE=<app> -DINPUT=<xinp-file> -DREFERENCE=<xinp-file>
+#              [-DARGS=<options>] [-DPREC=<digits>] -P CompareInputs.cmake
+
+if(NOT EXE OR NOT INPUT OR NOT REFERENCE)
+  message(FATAL_ERROR "usage: cmake -DEXE=<app> -DINPUT=<xinp-file>"
+                      " -DREFERENCE=<xinp-file> [-DARGS=<options>]"
+                      " [-DPREC=<digits>] -P CompareInputs.cmake")
+endif()
+if(NOT PREC)
+  set(PREC 4)
+endif()
+separate_arguments(ARGS)
+
+foreach(infile ${INPUT} ${REFERENCE})
+  execute_process(COMMAND ${EXE} ${infile} ${ARGS} -outPrec ${PREC}
+                  OUTPUT_VARIABLE log RESULT_VARIABLE status)
+  if(NOT status EQUAL 0)
+    message(FATAL_ERROR "${EXE} ${infile} ${ARGS} failed"
+                        " (status ${status}):\n${log}")
+  endif()
+
+  # Keep the time step results only
+  string(REGEX MATCHALL "  step=[^\n]*|[^\n]*(norm|Max)[^\n]*: [^\n]*"
+                        log "${log}")
+  if(NOT log)
+    message(FATAL_ERROR "No time step results from ${EXE} ${infile}")
+  endif()
+  list(JOIN log "\n" log)
+  set(log_${infile} "${log}")
+endforeach()
+
+if(NOT log_${INPUT} STREQUAL log_${REFERENCE})
+  file(WRITE ${INPUT}.log "${log_${INPUT}}")
+  file(WRITE ${REFERENCE}.log "${log_${REFERENCE}}")
+  message(FATAL_ERROR "Results of ${INPUT} ${ARGS} differ from the"
+                      " results of ${REFERENCE}, see ${INPUT}.log"
+                      " and ${REFERENCE}.log")
+endif()
@@ -0,0 +1,162 @@
+# $Id$
+# This script runs a simulation with one and with many OpenMP threads,
+# and checks that the printed results agree within a relative tolerance.
+# The words of the two outputs are compared one by one. Words that are not
+# numbers must be identical, whereas numbers must agree to DIGITS significant
+# digits (default 10). Numbers less than 10^ZERO in magnitude (default -10)
+# are considered zero, since they are dominated by round-off errors.
+# Usage: cmake -DEXE=<app> -DINPUT=<xinp-file> [-DARGS=<options>]
+#              [-DNTHREADS=<n>] [-DDIGITS=<n>] [-DZERO=<exp>]
+#              -P CompareThreads.cmake
+
+if(NOT EXE OR NOT INPUT)
+  message(FATAL_ERROR "usage: cmake -DEXE=<app> -DINPUT=<xinp-file>"
+                      " [-DARGS=<options>] [-DNTHREADS=<n>]"
+                      " [-DDIGITS=<n>] [-DZERO=<exp>]"
+                      " -P CompareThreads.cmake")
+endif()
+if(NOT NTHREADS)
+  cmake_host_system_information(RESULT NTHREADS
+                                QUERY NUMBER_OF_LOGICAL_CORES)
+  if(NTHREADS LESS 4)
+    set(NTHREADS 4)
+  endif()
+endif()
+if(NOT DIGITS)
+  set(DIGITS 10)
+endif()
+if(NOT DEFINED ZERO)
+  set(ZERO -10)
+endif()
+separate_arguments(ARGS)
+cmake_policy(SET CMP0007 NEW)
+
+# The numbers are compared through their first NSIG significant digits,
+# allowing a difference of one unit in the DIGITS'th digit
+math(EXPR NSIG "${DIGITS} + 2")
+set(NTOL 100)
+
+# Splits the number STR into an integer significand of NSIG digits and
+# a decimal exponent, such that STR = SIG*10^(EXP-NSIG).
+# SIG is empty if STR is not a number, and zero if STR is less than 10^ZERO.
+function(split_number STR SIG EXP)
+  set(${SIG} "" PARENT_SCOPE)
+  if(NOT STR MATCHES "^([-+]?)([0-9]*)\\.?([0-9]*)([eE]([-+]?)0*([0-9]+))?$")
+    return()
+  elseif(CMAKE_MATCH_2 STREQUAL "" AND CMAKE_MATCH_3 STREQUAL "")
+    return()
+  endif()
+
+  set(sign "${CMAKE_MATCH_1}")
+  set(digits "${CMAKE_MATCH_2}${CMAKE_MATCH_3}")
+  string(LENGTH "${CMAKE_MATCH_2}" exp)
+  if(CMAKE_MATCH_5 STREQUAL "-")
+    math(EXPR exp "${exp} - ${CMAKE_MATCH_6}")
+  elseif(CMAKE_MATCH_6)
+    math(EXPR exp "${exp} + ${CMAKE_MATCH_6}")
+  endif()
+
+  # Remove leading zeros, and pad or truncate to NSIG digits
+  string(LENGTH "${digits}" ndig)
+  string(REGEX REPLACE "^0+" "" digits "${digits}")
+  string(LENGTH "${digits}" nzero)
+  math(EXPR exp "${exp} - ${ndig} + ${nzero}")
+  if(digits STREQUAL "" OR exp LESS ZERO)
+    set(${SIG} 0 PARENT_SCOPE)
+    set(${EXP} 0 PARENT_SCOPE)
+    return()
+  endif()
+  string(APPEND digits "0000000000000000000")
+  string(SUBSTRING "${digits}" 0 ${NSIG} digits)
+  if(sign STREQUAL "-")
+    set(digits "-${digits}")
+  endif()
+
+  set(${SIG} ${digits} PARENT_SCOPE)
+  set(${EXP} ${exp} PARENT_SCOPE)
+endfunction()
+
+# Checks whether the words W1 and W2 are equal, or numerically close.
+function(compare_words W1 W2 RESULT)
+  set(${RESULT} TRUE PARENT_SCOPE)
+  if(W1 STREQUAL W2)
+    return()
+  endif()
+
+  set(${RESULT} FALSE PARENT_SCOPE)
+  split_number("${W1}" s1 e1)
+  split_number("${W2}" s2 e2)
+  if(s1 STREQUAL "" OR s2 STREQUAL "")
+    return() # Not numbers
+  elseif(s1 EQUAL 0 OR s2 EQUAL 0)
+    if(s1 EQUAL s2)
+      set(${RESULT} TRUE PARENT_SCOPE)
+    endif()
+    return()
+  endif()
+
+  # Scale the number with the larger exponent, e.g., 9.99..e-1 vs 1.00..e+0
+  set(tol ${NTOL})
+  math(EXPR de "${e1} - ${e2}")
+  if(de EQUAL 1)
+    math(EXPR s1 "${s1} * 10")
+    math(EXPR tol "${tol} * 10")
+  elseif(de EQUAL -1)
+    math(EXPR s2 "${s2} * 10")
+    math(EXPR tol "${tol} * 10")
+  elseif(NOT de EQUAL 0)
+    return()
+  endif()
+
+  math(EXPR diff "${s1} - ${s2}")
+  if(diff LESS 0)
+    math(EXPR diff "-(${diff})")
+  endif()
+  if(NOT diff GREATER tol)
+    set(${RESULT} TRUE PARENT_SCOPE)
+  endif()
+endfunction()
+
+foreach(nthr 1 ${NTHREADS})
+  execute_process(COMMAND ${CMAKE_COMMAND} -E env OMP_NUM_THREADS=${nthr}
+                          ${EXE} ${INPUT} ${ARGS} -outPrec 16
+                  OUTPUT_VARIABLE log RESULT_VARIABLE status)
+  if(NOT status EQUAL 0)
+    message(FATAL_ERROR "${EXE} ${INPUT} ${ARGS} failed with"
+                        " ${nthr} threads (status ${status}):\n${log}")
+  endif()
+
+  # Skip timings and thread count information, which differ between runs
+  string(REGEX REPLACE "\n[^\n]*([Tt]hreads?|CPU|[Ww]all|[Ee]lapsed)[^\n]*"
+                       "" log "\n${log}")
+  set(log_${nthr} "${log}")
+endforeach()
+
+set(equal TRUE)
+if(NOT log_1 STREQUAL log_${NTHREADS})
+  # Compare the two outputs word by word
+  set(sep "[] \t\n[=:,;(){}\\]+")
+  string(REGEX REPLACE "${sep}" ";" words_1 "${log_1}")
+  string(REGEX REPLACE "${sep}" ";" words_n "${log_${NTHREADS}}")
+  list(LENGTH words_1 nwords)
+  list(LENGTH words_n nwords_n)
+  if(NOT nwords EQUAL nwords_n)
+    set(equal FALSE)
+  else()
+    foreach(w1 w2 IN ZIP_LISTS words_1 words_n)
+      compare_words("${w1}" "${w2}" equal)
+      if(NOT equal)
+        message(STATUS "First difference: ${w1} vs ${w2}")
+        break()
+      endif()
+    endforeach()
+  endif()
+endif()
+
+if(NOT equal)
+  file(WRITE ${INPUT}-1.log "${log_1}")
+  file(WRITE ${INPUT}-${NTHREADS}.log "${log_${NTHREADS}}")
+  message(FATAL_ERROR "Results of ${INPUT} ${ARGS} with ${NTHREADS}"
+                      " threads differ from the single-threaded results,"
+                      " see ${INPUT}-1.log and ${INPUT}-${NTHREADS}.log")
+endif()